@@ -1,6 +1,6 @@
 #pragma once
 
-#include "structure/container/spk_thread_safe_queue.hpp"
+#include "structure/container/spk_mpsc_queue.hpp"
 #include "structure/system/event/spk_event.hpp"
 
 #include "widget/spk_widget.hpp"
@@ -18,7 +18,7 @@ namespace spk
 	class Module : public IModule
 	{
 	private:
-		spk::ThreadSafeQueue<TEventType> _eventQueue;
+		spk::MPSCQueue<TEventType> _eventQueue;
 
 		virtual void _treatEvent(TEventType&& p_event) = 0;
 		virtual TEventType _convertEventToEventType(spk::Event&& p_event) = 0;
@@ -47,10 +47,9 @@ namespace spk
 
 		void treatMessages()
 		{
-			while (_eventQueue.empty() == false)
-			{
-				_treatEvent(std::move(_eventQueue.pop()));
-			}
+			_eventQueue.drain([&](TEventType&& p_event) {
+					_treatEvent(std::move(p_event));
+				});
 		}
 	};
 }
\ No newline at end of file
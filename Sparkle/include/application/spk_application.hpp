@@ -5,6 +5,9 @@
 
 #include "structure/design_pattern/spk_contract_provider.hpp"
 #include "structure/thread/spk_persistant_worker.hpp"
+#include "structure/thread/spk_job_system.hpp"
+#include "structure/thread/spk_task_graph.hpp"
+#include "structure/thread/spk_thread_placement.hpp"
 
 #include "structure/spk_safe_pointer.hpp"
 
@@ -26,6 +29,12 @@ namespace spk
 		std::atomic<bool> _isRunning;
 		std::atomic<int> _errorCode;
 
+		// Declared before the workers so they are destroyed after every worker is joined
+		std::once_flag _jobSystemFlag;
+		spk::ThreadPlacement _jobSystemPlacement;
+		std::unique_ptr<spk::JobSystem> _jobSystem;
+		spk::TaskGraph _taskGraph;
+
 		std::unordered_map<std::wstring, std::unique_ptr<spk::PersistantWorker>> _workers;
 		spk::SafePointer<spk::PersistantWorker> _mainThreadWorker;
 
@@ -38,9 +47,26 @@ namespace spk
 		Contract addExecutionStep(const std::wstring& p_threadName, const Job& p_job);
 		Contract addExecutionStep(const Job& p_job);
 
+		Contract addBudgetedStep(const std::wstring& p_threadName, const std::wstring& p_stepName, std::chrono::nanoseconds p_budget, const Job& p_job);
+		Contract addBudgetedStep(const std::wstring& p_stepName, std::chrono::nanoseconds p_budget, const Job& p_job);
+
+		Contract addFixedStep(const std::wstring& p_threadName, const std::wstring& p_stepName, std::chrono::nanoseconds p_timestep, const Job& p_job,
+			std::chrono::nanoseconds p_budget = std::chrono::nanoseconds(0), size_t p_maxCatchUpStep = spk::TimedStep::DefaultMaxCatchUpStep);
+		Contract addFixedStep(const std::wstring& p_stepName, std::chrono::nanoseconds p_timestep, const Job& p_job,
+			std::chrono::nanoseconds p_budget = std::chrono::nanoseconds(0), size_t p_maxCatchUpStep = spk::TimedStep::DefaultMaxCatchUpStep);
+
 		PreparationContract addPreparationStep(const std::wstring& p_threadName, const PreparationJob& p_job);
 		PreparationContract addPreparationStep(const PreparationJob& p_job);
 
+		spk::JobSystem& jobSystem();
+
+		// Pins every worker on its own core and leaves the remaining cores to the job system, must be called before jobSystem() and run()
+		void placeWorkers(const spk::CpuTopology& p_topology = spk::CpuTopology::local());
+
+		spk::TaskGraph& taskGraph();
+		spk::TaskGraph::TaskID addGraphTask(const std::wstring& p_threadName, const std::wstring& p_taskName, const Job& p_job);
+		spk::TaskGraph::TaskID addGraphTask(const std::wstring& p_taskName, const Job& p_job);
+
 		int run();
 
 		void quit(int p_errorCode);
@@ -2,6 +2,7 @@
 
 #include "application/spk_application.hpp"
 
+#include "structure/container/spk_thread_safe_queue.hpp"
 #include "structure/spk_safe_pointer.hpp"
 #include "structure/graphics/spk_window.hpp"
 
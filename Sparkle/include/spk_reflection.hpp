@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "spk_sfinae.hpp"
+
+namespace spk
+{
+	template <typename TType>
+	constexpr auto toTuple(TType& p_object)
+	{
+		constexpr size_t count = FieldCount<std::remove_cv_t<TType>>::value;
+
+		static_assert(HasTooManyReflectedFields<std::remove_cv_t<TType>>::value == false, "Unable to reflect an aggregate with more than 16 fields.");
+		static_assert(HasCArrayField<std::remove_cv_t<TType>>::value == false, "Unable to reflect an aggregate holding a C array member, use std::array instead.");
+		static_assert(IsReflectable<std::remove_cv_t<TType>>::value, "Unable to reflect this type.");
+
+		if constexpr (IsReflectable<std::remove_cv_t<TType>>::value == false)
+		{
+			return (std::tuple<>());
+		}
+		else if constexpr (count == 1)
+		{
+			auto& [f0] = p_object;
+			return (std::tie(f0));
+		}
+		else if constexpr (count == 2)
+		{
+			auto& [f0, f1] = p_object;
+			return (std::tie(f0, f1));
+		}
+		else if constexpr (count == 3)
+		{
+			auto& [f0, f1, f2] = p_object;
+			return (std::tie(f0, f1, f2));
+		}
+		else if constexpr (count == 4)
+		{
+			auto& [f0, f1, f2, f3] = p_object;
+			return (std::tie(f0, f1, f2, f3));
+		}
+		else if constexpr (count == 5)
+		{
+			auto& [f0, f1, f2, f3, f4] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4));
+		}
+		else if constexpr (count == 6)
+		{
+			auto& [f0, f1, f2, f3, f4, f5] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5));
+		}
+		else if constexpr (count == 7)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6));
+		}
+		else if constexpr (count == 8)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7));
+		}
+		else if constexpr (count == 9)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8));
+		}
+		else if constexpr (count == 10)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9));
+		}
+		else if constexpr (count == 11)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10));
+		}
+		else if constexpr (count == 12)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11));
+		}
+		else if constexpr (count == 13)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12));
+		}
+		else if constexpr (count == 14)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13));
+		}
+		else if constexpr (count == 15)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14));
+		}
+		else if constexpr (count == 16)
+		{
+			auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = p_object;
+			return (std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15));
+		}
+	}
+
+	template <typename TType, typename TFunctor>
+	constexpr void forEachField(TType& p_object, TFunctor&& p_functor)
+	{
+		std::apply([&](auto&... p_fields) { (p_functor(p_fields), ...); }, toTuple(p_object));
+	}
+
+	template <typename TType>
+	constexpr uint64_t layoutHash();
+
+	template <typename TTuple, size_t... TIndexes>
+	constexpr uint64_t fieldsLayoutHash(uint64_t p_hash, std::index_sequence<TIndexes...>)
+	{
+		((p_hash = (p_hash ^ layoutHash<std::remove_cvref_t<std::tuple_element_t<TIndexes, TTuple>>>()) * 1099511628211ull), ...);
+		return (p_hash);
+	}
+
+	template <typename TType>
+	constexpr uint64_t layoutHash()
+	{
+		uint64_t hash = 14695981039346656037ull;
+		auto mix = [&hash](uint64_t p_value) { hash = (hash ^ p_value) * 1099511628211ull; };
+
+		if constexpr (IsContainer<TType>::value == true)
+		{
+			mix(1);
+			mix(layoutHash<typename TType::value_type>());
+		}
+		else if constexpr (IsReflectable<TType>::value == true)
+		{
+			using Fields = decltype(toTuple(std::declval<TType&>()));
+
+			mix(2);
+			mix(FieldCount<TType>::value);
+			hash = fieldsLayoutHash<Fields>(hash, std::make_index_sequence<std::tuple_size_v<Fields>>());
+		}
+		else
+		{
+			mix(3);
+			mix(sizeof(TType));
+			mix(alignof(TType));
+			mix(std::is_floating_point_v<TType>);
+			mix(std::is_signed_v<TType>);
+		}
+
+		return (hash);
+	}
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace spk
 {
@@ -8,4 +10,64 @@ namespace spk
 
 	template <typename T>
 	struct IsContainer<T, std::void_t<decltype(std::declval<T>().begin()), decltype(std::declval<T>().end()), typename T::value_type>> : std::true_type {};
+
+	template <typename T, typename = void>
+	struct IsContiguousContainer : std::false_type {};
+
+	template <typename T>
+	struct IsContiguousContainer<T, std::void_t<decltype(std::declval<T>().data()), decltype(std::declval<T>().size()), typename T::value_type>> :
+		std::bool_constant<IsContainer<T>::value && std::is_pointer_v<decltype(std::declval<T>().data())>> {};
+
+	template <typename T, typename = void>
+	struct IsTriviallySerializableContainer : std::false_type {};
+
+	template <typename T>
+	struct IsTriviallySerializableContainer<T, std::enable_if_t<IsContiguousContainer<T>::value>> :
+		std::bool_constant<std::is_trivially_copyable_v<typename T::value_type> && IsContainer<typename T::value_type>::value == false> {};
+
+	template <typename T, typename = void>
+	struct IsResizableContainer : std::false_type {};
+
+	template <typename T>
+	struct IsResizableContainer<T, std::void_t<decltype(std::declval<T&>().resize(std::declval<size_t>()))>> : IsContainer<T> {};
+
+	static constexpr size_t MaxReflectedFieldCount = 16;
+
+	struct AnyField
+	{
+		template <typename T>
+		operator T&() const;
+	};
+
+	template <typename T, typename TIndexes, typename = void>
+	struct IsBraceConstructible : std::false_type {};
+
+	template <typename T, size_t... TIndexes>
+	struct IsBraceConstructible<T, std::index_sequence<TIndexes...>, std::void_t<decltype(T{ (static_cast<void>(TIndexes), AnyField{})... })>> : std::true_type {};
+
+	template <typename T, size_t N = MaxReflectedFieldCount>
+	struct FieldCount : std::conditional_t<IsBraceConstructible<T, std::make_index_sequence<N>>::value, std::integral_constant<size_t, N>, FieldCount<T, N - 1>> {};
+
+	template <typename T>
+	struct FieldCount<T, 0> : std::integral_constant<size_t, 0> {};
+
+	template <typename T>
+	struct HasTooManyReflectedFields : IsBraceConstructible<T, std::make_index_sequence<MaxReflectedFieldCount + 1>> {};
+
+	template <typename T, typename TIndexes>
+	struct IsParenthesisConstructible : std::false_type {};
+
+	template <typename T, size_t... TIndexes>
+	struct IsParenthesisConstructible<T, std::index_sequence<TIndexes...>> : std::is_constructible<T, decltype(static_cast<void>(TIndexes), AnyField{})...> {};
+
+	// Brace elision spreads C array members over several fields, which parenthesis initialization refuses
+	template <typename T>
+	struct HasCArrayField : std::bool_constant<(FieldCount<T>::value > 1) && IsParenthesisConstructible<T, std::make_index_sequence<FieldCount<T>::value>>::value == false> {};
+
+	template <typename T, typename = void>
+	struct IsReflectable : std::false_type {};
+
+	template <typename T>
+	struct IsReflectable<T, std::enable_if_t<std::is_class_v<T> && std::is_aggregate_v<T> && !IsContainer<T>::value>> :
+		std::bool_constant<(FieldCount<T>::value > 0) && HasTooManyReflectedFields<T>::value == false && HasCArrayField<T>::value == false> {};
 }
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "structure/container/spk_data_buffer.hpp"
+#include "structure/container/spk_data_buffer_serializer.hpp"
+#include "structure/container/spk_data_buffer_view.hpp"
+
+namespace spk
+{
+	class ChunkedDataBuffer
+	{
+	public:
+		using Encoding = spk::DataBufferSerializer::Encoding;
+
+		static constexpr size_t DefaultChunkSize = 64 * 1024;
+
+	private:
+		size_t _chunkSize;
+		std::vector<std::unique_ptr<uint8_t[]>> _chunks;
+		size_t _size;
+		mutable size_t _bookmark;
+		Encoding _encoding;
+
+	public:
+		ChunkedDataBuffer(const size_t& p_chunkSize = DefaultChunkSize);
+
+		ChunkedDataBuffer(const ChunkedDataBuffer& p_other) = delete;
+		ChunkedDataBuffer& operator=(const ChunkedDataBuffer& p_other) = delete;
+
+		ChunkedDataBuffer(ChunkedDataBuffer&& p_other) noexcept = default;
+		ChunkedDataBuffer& operator=(ChunkedDataBuffer&& p_other) noexcept = default;
+
+		inline size_t chunkSize() const { return _chunkSize; }
+
+		inline size_t nbChunk() const { return _chunks.size(); }
+
+		inline size_t size() const { return _size; }
+
+		inline size_t bookmark() const { return _bookmark; }
+
+		inline size_t leftover() const { return size() - bookmark(); }
+
+		inline bool empty() const { return leftover() == 0; }
+
+		inline Encoding encoding() const { return _encoding; }
+
+		inline void setEncoding(const Encoding& p_encoding) { _encoding = p_encoding; }
+
+		void skip(const size_t& p_number);
+
+		void clear();
+
+		void reset();
+
+		void append(const void* p_data, const size_t& p_dataSize);
+
+		void extract(void* p_destination, const size_t& p_dataSize) const;
+
+		DataBuffer flatten() const;
+
+		std::vector<DataBufferView> chunks() const;
+
+		template <typename OutputType>
+		OutputType get() const
+		{
+			OutputType result;
+			*this >> result;
+			return (result);
+		}
+
+		template <typename InputType>
+		ChunkedDataBuffer& operator<<(const InputType& p_input)
+		{
+			spk::DataBufferSerializer::write(*this, p_input);
+			return *this;
+		}
+
+		template <typename OutputType>
+		const ChunkedDataBuffer& operator>>(OutputType& p_output) const
+		{
+			spk::DataBufferSerializer::read(*this, p_output);
+			return *this;
+		}
+	};
+}
\ No newline at end of file
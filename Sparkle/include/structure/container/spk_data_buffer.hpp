@@ -1,23 +1,62 @@
 #pragma once
 
-#pragma once
-
 #include <vector>
 #include <cstdint>
 #include <string>
 #include <cstring>
 #include <stdexcept>
+#include <memory>
 #include <mutex>
+#include <type_traits>
+#include <utility>
 
-#include "spk_sfinae.hpp"
+#include "structure/container/spk_data_buffer_serializer.hpp"
+#include "structure/container/spk_data_buffer_view.hpp"
 
 namespace spk
 {
     class DataBuffer
     {
+    public:
+        using Encoding = spk::DataBufferSerializer::Encoding;
+
     private:
-        std::vector<uint8_t> _data;
+        // Leaves new bytes uninitialized, so bytes about to be overwritten are not zero-filled first
+        template <typename TType>
+        struct DefaultInitAllocator : public std::allocator<TType>
+        {
+            template <typename TOther>
+            struct rebind
+            {
+                using other = DefaultInitAllocator<TOther>;
+            };
+
+            DefaultInitAllocator() noexcept = default;
+
+            template <typename TOther>
+            DefaultInitAllocator(const DefaultInitAllocator<TOther>&) noexcept
+            {
+
+            }
+
+            template <typename TOther>
+            void construct(TOther* p_pointer) noexcept(std::is_nothrow_default_constructible_v<TOther>)
+            {
+                ::new (static_cast<void*>(p_pointer)) TOther;
+            }
+
+            template <typename TOther, typename... TArgs>
+            void construct(TOther* p_pointer, TArgs&&... p_args)
+            {
+                ::new (static_cast<void*>(p_pointer)) TOther(std::forward<TArgs>(p_args)...);
+            }
+        };
+
+        std::vector<uint8_t, DefaultInitAllocator<uint8_t>> _data;
         mutable size_t _bookmark;
+        Encoding _encoding;
+
+        void _growFor(const size_t& p_additionalSize);
 
     public:
         DataBuffer();
@@ -42,8 +81,19 @@ namespace spk
 
         inline bool empty() const { return leftover() == 0; }
 
+        inline size_t capacity() const { return _data.capacity(); }
+
+        inline Encoding encoding() const { return _encoding; }
+
+        inline void setEncoding(const Encoding& p_encoding) { _encoding = p_encoding; }
+
+        void reserve(const size_t& p_capacity);
+
         void resize(const size_t& p_newSize);
 
+        // Same as resize, but new bytes are left uninitialized for the caller to overwrite
+        void resizeForOverwrite(const size_t& p_newSize);
+
         void skip(const size_t& p_number);
 
         void clear();
@@ -74,57 +124,42 @@ namespace spk
             memcpy(_data.data() + p_offset, p_data, p_dataSize);
         }
 
-        template <typename InputType, typename std::enable_if_t<!spk::IsContainer<InputType>::value>* = nullptr>
+        template <typename InputType>
         DataBuffer& operator<<(const InputType& p_input)
         {
-            static_assert(std::is_standard_layout<InputType>::value, "Unable to handle this type.");
-
-            size_t previous_size(_data.size());
-
-            _data.resize(_data.size() + sizeof(InputType));
-            std::memcpy(_data.data() + previous_size, &p_input, sizeof(InputType));
-
+            spk::DataBufferSerializer::write(*this, p_input);
             return *this;
         }
 
-        template <typename OutputType, typename std::enable_if_t<!spk::IsContainer<OutputType>::value>* = nullptr>
+        template <typename OutputType>
         const DataBuffer& operator>>(OutputType& p_output) const
         {
-            static_assert(std::is_standard_layout<OutputType>::value, "Unable to handle this type.");
-            if (leftover() < sizeof(OutputType))
-                throw std::runtime_error("Unable to retrieve data buffer content.");
-            std::memcpy(&p_output, _data.data() + bookmark(), sizeof(OutputType));
-            _bookmark += sizeof(OutputType);
+            spk::DataBufferSerializer::read(*this, p_output);
             return *this;
         }
 
-        template <typename InputType, typename std::enable_if_t<spk::IsContainer<InputType>::value>* = nullptr>
-        DataBuffer& operator<<(const InputType& p_input)
+        void extract(void* p_destination, const size_t& p_dataSize) const
         {
-            *this << p_input.size();
-            for (auto it = p_input.begin(); it != p_input.end(); ++it)
-            {
-                *this << *it;
-            }
-            return *this;
+            if (leftover() < p_dataSize)
+                throw std::runtime_error("Unable to retrieve data buffer content.");
+            std::memcpy(p_destination, _data.data() + bookmark(), p_dataSize);
+            _bookmark += p_dataSize;
         }
 
-        template <typename OutputType, typename std::enable_if_t<spk::IsContainer<OutputType>::value>* = nullptr>
-        const DataBuffer& operator>>(OutputType& p_output) const
-        {
-            p_output.resize(this->get<size_t>());
-            for (auto it = p_output.begin(); it != p_output.end(); ++it)
-            {
-                *this >> *it;
-            }
-            return *this;
-        }
+        DataBufferView view() const;
+
+        DataBufferView slice(const size_t& p_offset, const size_t& p_size) const;
+
+        DataBuffer compress(const size_t& p_nbThread = 1) const;
+
+        DataBuffer decompress(const size_t& p_nbThread = 1) const;
 
         void append(const void* p_data, const size_t& p_dataSize)
         {
             size_t oldSize = size();
-            resize(size() + p_dataSize);
-            edit(oldSize, p_data, p_dataSize);
+            _growFor(p_dataSize);
+            _data.resize(oldSize + p_dataSize);
+            std::memcpy(_data.data() + oldSize, p_data, p_dataSize);
         }
     };
 }
\ No newline at end of file
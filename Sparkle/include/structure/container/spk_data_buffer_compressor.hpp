@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "structure/container/spk_data_buffer.hpp"
+#include "structure/container/spk_data_buffer_view.hpp"
+
+namespace spk
+{
+	class DataBufferCompressor
+	{
+	public:
+		static constexpr uint32_t Magic = 0x5A4B5053;
+		static constexpr size_t DefaultBlockSize = 1024 * 1024;
+		static constexpr size_t MaxBlockSize = 64 * 1024 * 1024;
+
+	private:
+		static constexpr size_t MinMatchLength = 4;
+		static constexpr size_t MaxOffset = 65535;
+		static constexpr size_t HashLog = 14;
+		static constexpr uint32_t StoredBlockFlag = 0x80000000;
+		// A token byte followed by length bytes extends a match by 255 bytes at most
+		static constexpr uint64_t MaxCompressionRatio = 256;
+
+		static size_t _compressBlock(const uint8_t* p_source, size_t p_sourceSize, uint8_t* p_destination);
+		static void _decompressBlock(const uint8_t* p_source, size_t p_sourceSize, uint8_t* p_destination, size_t p_destinationSize);
+
+		template <typename TJob>
+		static void _dispatch(size_t p_nbJob, size_t p_nbThread, const TJob& p_job);
+
+	public:
+		static size_t compressBound(size_t p_sourceSize);
+
+		static DataBuffer compress(const DataBufferView& p_source, size_t p_nbThread = 1, size_t p_blockSize = DefaultBlockSize);
+		static DataBuffer decompress(const DataBufferView& p_source, size_t p_nbThread = 1);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "spk_sfinae.hpp"
+#include "spk_reflection.hpp"
+
+namespace spk
+{
+	struct DataBufferSerializer
+	{
+	private:
+		template <typename TContainer>
+		static void _resize(TContainer& p_container, size_t p_nbElement)
+		{
+			if constexpr (spk::IsResizableContainer<TContainer>::value == true)
+				p_container.resize(p_nbElement);
+		}
+
+	public:
+		enum class Encoding
+		{
+			Raw,
+			Compact
+		};
+
+		template <typename T>
+		static constexpr bool IsVarintEncodable = std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) > 1;
+
+		template <typename TBuffer>
+		static void writeVarint(TBuffer& p_buffer, uint64_t p_value)
+		{
+			uint8_t bytes[10];
+			size_t nbBytes = 0;
+
+			while (p_value >= 0x80)
+			{
+				bytes[nbBytes++] = static_cast<uint8_t>(p_value) | 0x80;
+				p_value >>= 7;
+			}
+			bytes[nbBytes++] = static_cast<uint8_t>(p_value);
+
+			p_buffer.append(bytes, nbBytes);
+		}
+
+		template <typename TBuffer>
+		static uint64_t readVarint(const TBuffer& p_buffer)
+		{
+			uint64_t result = 0;
+
+			for (size_t shift = 0; shift < 64; shift += 7)
+			{
+				uint8_t byte;
+				p_buffer.extract(&byte, 1);
+
+				if (shift == 63 && (byte & 0x7E) != 0)
+					throw std::runtime_error("Unable to decode varint, value does not fit in 64 bits.");
+
+				result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+					return (result);
+			}
+			throw std::runtime_error("Unable to decode varint, encoding is too long.");
+		}
+
+		static constexpr uint64_t zigzagEncode(int64_t p_value)
+		{
+			return ((static_cast<uint64_t>(p_value) << 1) ^ static_cast<uint64_t>(p_value >> 63));
+		}
+
+		static constexpr int64_t zigzagDecode(uint64_t p_value)
+		{
+			return (static_cast<int64_t>(p_value >> 1) ^ -static_cast<int64_t>(p_value & 1));
+		}
+
+		template <typename TBuffer, typename InputType>
+		static void write(TBuffer& p_buffer, const InputType& p_input)
+		{
+			if constexpr (spk::IsContainer<InputType>::value == true)
+			{
+				size_t nbElement = p_input.size();
+
+				if (p_buffer.encoding() == Encoding::Compact)
+					writeVarint(p_buffer, nbElement);
+				else
+					p_buffer.append(&nbElement, sizeof(size_t));
+
+				if constexpr (spk::IsTriviallySerializableContainer<InputType>::value == true)
+				{
+					if (IsVarintEncodable<typename InputType::value_type> == false || p_buffer.encoding() == Encoding::Raw)
+					{
+						if (nbElement != 0)
+							p_buffer.append(p_input.data(), nbElement * sizeof(typename InputType::value_type));
+						return;
+					}
+				}
+
+				for (auto it = p_input.begin(); it != p_input.end(); ++it)
+				{
+					write(p_buffer, *it);
+				}
+			}
+			else if constexpr (IsVarintEncodable<InputType> == true)
+			{
+				if (p_buffer.encoding() == Encoding::Raw)
+					p_buffer.append(&p_input, sizeof(InputType));
+				else if constexpr (std::is_signed_v<InputType> == true)
+					writeVarint(p_buffer, zigzagEncode(static_cast<int64_t>(p_input)));
+				else
+					writeVarint(p_buffer, static_cast<uint64_t>(p_input));
+			}
+			else if constexpr (spk::IsReflectable<InputType>::value == true)
+			{
+				if (std::is_trivially_copyable_v<InputType> == true && p_buffer.encoding() == Encoding::Raw)
+					p_buffer.append(&p_input, sizeof(InputType));
+				else
+					spk::forEachField(p_input, [&](const auto& p_field) { write(p_buffer, p_field); });
+			}
+			else
+			{
+				static_assert(std::is_standard_layout<InputType>::value || std::is_trivially_copyable_v<InputType>, "Unable to handle this type.");
+
+				p_buffer.append(&p_input, sizeof(InputType));
+			}
+		}
+
+		template <typename TBuffer, typename OutputType>
+		static void read(const TBuffer& p_buffer, OutputType& p_output)
+		{
+			if constexpr (spk::IsContainer<OutputType>::value == true)
+			{
+				size_t nbElement;
+
+				if (p_buffer.encoding() == Encoding::Compact)
+					read(p_buffer, nbElement);
+				else
+					p_buffer.extract(&nbElement, sizeof(size_t));
+
+				if constexpr (spk::IsResizableContainer<OutputType>::value == false)
+				{
+					if (nbElement != p_output.size())
+						throw std::runtime_error("Unable to retrieve data buffer content, fixed size container mismatch.");
+				}
+
+				if constexpr (spk::IsTriviallySerializableContainer<OutputType>::value == true)
+				{
+					if (IsVarintEncodable<typename OutputType::value_type> == false || p_buffer.encoding() == Encoding::Raw)
+					{
+						size_t nbBytes = nbElement * sizeof(typename OutputType::value_type);
+						if (p_buffer.leftover() < nbBytes)
+							throw std::runtime_error("Unable to retrieve data buffer content.");
+						_resize(p_output, nbElement);
+						if (nbBytes != 0)
+							p_buffer.extract(p_output.data(), nbBytes);
+						return;
+					}
+				}
+
+				if (p_buffer.leftover() < nbElement)
+					throw std::runtime_error("Unable to retrieve data buffer content.");
+				_resize(p_output, nbElement);
+				for (auto it = p_output.begin(); it != p_output.end(); ++it)
+				{
+					read(p_buffer, *it);
+				}
+			}
+			else if constexpr (IsVarintEncodable<OutputType> == true)
+			{
+				if (p_buffer.encoding() == Encoding::Raw)
+					p_buffer.extract(&p_output, sizeof(OutputType));
+				else if constexpr (std::is_signed_v<OutputType> == true)
+				{
+					int64_t value = zigzagDecode(readVarint(p_buffer));
+					if (value < std::numeric_limits<OutputType>::min() || value > std::numeric_limits<OutputType>::max())
+						throw std::runtime_error("Unable to decode varint, value is out of range for the target type.");
+					p_output = static_cast<OutputType>(value);
+				}
+				else
+				{
+					uint64_t value = readVarint(p_buffer);
+					if (value > std::numeric_limits<OutputType>::max())
+						throw std::runtime_error("Unable to decode varint, value is out of range for the target type.");
+					p_output = static_cast<OutputType>(value);
+				}
+			}
+			else if constexpr (spk::IsReflectable<OutputType>::value == true)
+			{
+				if (std::is_trivially_copyable_v<OutputType> == true && p_buffer.encoding() == Encoding::Raw)
+					p_buffer.extract(&p_output, sizeof(OutputType));
+				else
+					spk::forEachField(p_output, [&](auto& p_field) { read(p_buffer, p_field); });
+			}
+			else
+			{
+				static_assert(std::is_standard_layout<OutputType>::value || std::is_trivially_copyable_v<OutputType>, "Unable to handle this type.");
+
+				p_buffer.extract(&p_output, sizeof(OutputType));
+			}
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <stdexcept>
+
+#include "structure/container/spk_data_buffer_serializer.hpp"
+
+namespace spk
+{
+	class DataBufferView
+	{
+	public:
+		using Encoding = spk::DataBufferSerializer::Encoding;
+
+	private:
+		const uint8_t* _data;
+		size_t _size;
+		mutable size_t _bookmark;
+		Encoding _encoding;
+
+	public:
+		DataBufferView();
+
+		DataBufferView(const void* p_data, size_t p_size, const Encoding& p_encoding = Encoding::Raw);
+
+		const uint8_t* data() const
+		{
+			return (_data);
+		}
+
+		inline size_t size() const { return _size; }
+
+		inline size_t bookmark() const { return _bookmark; }
+
+		inline size_t leftover() const { return size() - bookmark(); }
+
+		inline bool empty() const { return leftover() == 0; }
+
+		inline Encoding encoding() const { return _encoding; }
+
+		inline void setEncoding(const Encoding& p_encoding) { _encoding = p_encoding; }
+
+		void skip(const size_t& p_number);
+
+		void reset();
+
+		void extract(void* p_destination, const size_t& p_dataSize) const;
+
+		DataBufferView slice(const size_t& p_offset, const size_t& p_size) const;
+
+		template <typename OutputType>
+		OutputType get() const
+		{
+			OutputType result;
+			*this >> result;
+			return (result);
+		}
+
+		template <typename OutputType>
+		const DataBufferView& operator>>(OutputType& p_output) const
+		{
+			spk::DataBufferSerializer::read(*this, p_output);
+			return *this;
+		}
+	};
+}
\ No newline at end of file
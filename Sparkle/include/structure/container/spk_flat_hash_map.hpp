@@ -0,0 +1,183 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace spk
+{
+	template<typename TKey, typename TValue, typename THash = std::hash<TKey>>
+	class FlatHashMap
+	{
+	public:
+		struct Entry
+		{
+			TKey key;
+			TValue value;
+		};
+
+	private:
+		static constexpr size_t MinCapacity = 16;
+
+		std::vector<std::optional<Entry>> _slots;
+		size_t _size = 0;
+		THash _hasher;
+
+		size_t _mask() const
+		{
+			return (_slots.size() - 1);
+		}
+
+		size_t _home(const TKey& p_key) const
+		{
+			uint64_t hash = static_cast<uint64_t>(_hasher(p_key)) * 0x9E3779B97F4A7C15ull;
+			return (static_cast<size_t>(hash ^ (hash >> 32)) & _mask());
+		}
+
+		size_t _findSlot(const TKey& p_key) const
+		{
+			if (_slots.empty() == true)
+				return (SIZE_MAX);
+
+			for (size_t index = _home(p_key); _slots[index].has_value() == true; index = (index + 1) & _mask())
+			{
+				if (_slots[index]->key == p_key)
+					return (index);
+			}
+			return (SIZE_MAX);
+		}
+
+		void _rehash(size_t p_capacity)
+		{
+			std::vector<std::optional<Entry>> oldSlots = std::move(_slots);
+			_slots = std::vector<std::optional<Entry>>(p_capacity);
+
+			for (std::optional<Entry>& slot : oldSlots)
+			{
+				if (slot.has_value() == false)
+					continue;
+
+				size_t index = _home(slot->key);
+				while (_slots[index].has_value() == true)
+					index = (index + 1) & _mask();
+				_slots[index].emplace(std::move(*slot));
+			}
+		}
+
+	public:
+		FlatHashMap() = default;
+
+		FlatHashMap(size_t p_capacity)
+		{
+			reserve(p_capacity);
+		}
+
+		size_t size() const
+		{
+			return (_size);
+		}
+
+		bool empty() const
+		{
+			return (_size == 0);
+		}
+
+		size_t capacity() const
+		{
+			return (_slots.size());
+		}
+
+		void reserve(size_t p_nbElement)
+		{
+			size_t wantedCapacity = std::bit_ceil(std::max(MinCapacity, p_nbElement + p_nbElement / 3 + 1));
+
+			if (wantedCapacity > _slots.size())
+				_rehash(wantedCapacity);
+		}
+
+		void clear()
+		{
+			for (std::optional<Entry>& slot : _slots)
+				slot.reset();
+			_size = 0;
+		}
+
+		bool contains(const TKey& p_key) const
+		{
+			return (_findSlot(p_key) != SIZE_MAX);
+		}
+
+		TValue* find(const TKey& p_key)
+		{
+			size_t index = _findSlot(p_key);
+			return (index != SIZE_MAX ? &(_slots[index]->value) : nullptr);
+		}
+
+		const TValue* find(const TKey& p_key) const
+		{
+			size_t index = _findSlot(p_key);
+			return (index != SIZE_MAX ? &(_slots[index]->value) : nullptr);
+		}
+
+		template <typename... TArgs>
+		std::pair<TValue*, bool> tryEmplace(const TKey& p_key, TArgs&&... p_args)
+		{
+			if ((_size + 1) * 4 > _slots.size() * 3)
+				_rehash(std::max(MinCapacity, _slots.size() * 2));
+
+			size_t index = _home(p_key);
+			while (_slots[index].has_value() == true)
+			{
+				if (_slots[index]->key == p_key)
+					return {&(_slots[index]->value), false};
+				index = (index + 1) & _mask();
+			}
+
+			_slots[index].emplace(Entry{p_key, TValue(std::forward<TArgs>(p_args)...)});
+			_size++;
+			return {&(_slots[index]->value), true};
+		}
+
+		TValue& operator[](const TKey& p_key)
+		{
+			return (*(tryEmplace(p_key).first));
+		}
+
+		bool erase(const TKey& p_key)
+		{
+			size_t hole = _findSlot(p_key);
+			if (hole == SIZE_MAX)
+				return (false);
+
+			_slots[hole].reset();
+			_size--;
+
+			for (size_t index = (hole + 1) & _mask(); _slots[index].has_value() == true; index = (index + 1) & _mask())
+			{
+				size_t home = _home(_slots[index]->key);
+				if (((index - home) & _mask()) >= ((index - hole) & _mask()))
+				{
+					_slots[hole].emplace(std::move(*_slots[index]));
+					_slots[index].reset();
+					hole = index;
+				}
+			}
+			return (true);
+		}
+
+		template <typename TFunctor>
+		void forEach(TFunctor&& p_functor)
+		{
+			for (std::optional<Entry>& slot : _slots)
+			{
+				if (slot.has_value() == true)
+					p_functor(slot->key, slot->value);
+			}
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace spk
+{
+	class FrameArena : public std::pmr::memory_resource
+	{
+	public:
+		static constexpr size_t DefaultBlockSize = 256 * 1024;
+
+	private:
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> data;
+			size_t size;
+		};
+
+		size_t _blockSize;
+		std::vector<Block> _blocks;
+		size_t _currentBlock;
+		size_t _offset;
+
+		size_t _used;
+		size_t _highWaterMark;
+		size_t _nbAllocation;
+		size_t _nbReset;
+
+		void* do_allocate(size_t p_bytes, size_t p_alignment) override;
+		void do_deallocate(void* p_pointer, size_t p_bytes, size_t p_alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& p_other) const noexcept override;
+
+	public:
+		FrameArena(size_t p_blockSize = DefaultBlockSize);
+
+		FrameArena(const FrameArena& p_other) = delete;
+		FrameArena& operator=(const FrameArena& p_other) = delete;
+
+		void reset();
+
+		size_t used() const { return (_used); }
+		size_t capacity() const;
+		size_t highWaterMark() const { return (_highWaterMark); }
+		size_t nbAllocation() const { return (_nbAllocation); }
+		size_t nbReset() const { return (_nbReset); }
+		size_t nbBlock() const { return (_blocks.size()); }
+	};
+}
\ No newline at end of file
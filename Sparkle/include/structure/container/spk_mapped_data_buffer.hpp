@@ -0,0 +1,51 @@
+#pragma once
+
+#include <filesystem>
+
+#include "structure/container/spk_data_buffer_view.hpp"
+
+namespace spk
+{
+	class MappedDataBuffer : public DataBufferView
+	{
+	public:
+		enum class AccessPattern
+		{
+			Normal,
+			Sequential,
+			Random,
+			WillNeed
+		};
+
+	private:
+		std::filesystem::path _path;
+		void* _mappedData = nullptr;
+		size_t _mappedSize = 0;
+#ifdef _WIN32
+		void* _fileHandle = nullptr;
+		void* _mappingHandle = nullptr;
+#endif
+
+		void _release();
+
+	public:
+		MappedDataBuffer();
+		MappedDataBuffer(const std::filesystem::path& p_path, const AccessPattern& p_accessPattern = AccessPattern::Normal);
+		~MappedDataBuffer();
+
+		MappedDataBuffer(const MappedDataBuffer& p_other) = delete;
+		MappedDataBuffer& operator=(const MappedDataBuffer& p_other) = delete;
+
+		MappedDataBuffer(MappedDataBuffer&& p_other) noexcept;
+		MappedDataBuffer& operator=(MappedDataBuffer&& p_other) noexcept;
+
+		void open(const std::filesystem::path& p_path, const AccessPattern& p_accessPattern = AccessPattern::Normal);
+		void close();
+
+		bool isOpen() const;
+		const std::filesystem::path& path() const;
+
+		void advise(const AccessPattern& p_accessPattern);
+		void advise(const size_t& p_offset, const size_t& p_size, const AccessPattern& p_accessPattern);
+	};
+}
\ No newline at end of file
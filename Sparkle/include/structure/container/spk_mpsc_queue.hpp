@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace spk
+{
+	template <typename TType>
+	class MPSCQueue
+	{
+	public:
+		static constexpr size_t RecycleBatchSize = 64;
+
+	private:
+		static constexpr size_t CacheLineSize = 64;
+
+		struct Node
+		{
+			std::atomic<Node*> next = nullptr;
+			Node* nextFree = nullptr;
+			std::optional<TType> value;
+		};
+
+		static void _deleteChain(Node* p_node)
+		{
+			while (p_node != nullptr)
+			{
+				Node* next = p_node->nextFree;
+				delete p_node;
+				p_node = next;
+			}
+		}
+
+		struct RecycledNodes
+		{
+			std::atomic<Node*> head = nullptr;
+
+			~RecycledNodes()
+			{
+				_deleteChain(head.exchange(nullptr));
+			}
+		};
+
+		struct NodeCache
+		{
+			Node* head = nullptr;
+
+			~NodeCache()
+			{
+				_deleteChain(head);
+			}
+		};
+
+		static inline RecycledNodes _recycledNodes;
+
+		alignas(CacheLineSize) std::atomic<Node*> _head;
+		alignas(CacheLineSize) Node* _tail;
+		Node* _freedHead = nullptr;
+		Node* _freedTail = nullptr;
+		size_t _nbFreed = 0;
+
+		static Node* _allocateNode()
+		{
+			static thread_local NodeCache cache;
+
+			if (cache.head == nullptr)
+				cache.head = _recycledNodes.head.exchange(nullptr, std::memory_order_acquire);
+
+			if (cache.head == nullptr)
+				return (new Node());
+
+			Node* result = cache.head;
+			cache.head = result->nextFree;
+			result->next.store(nullptr, std::memory_order_relaxed);
+			return (result);
+		}
+
+		void _pushNode(Node* p_node)
+		{
+			Node* previous = _head.exchange(p_node, std::memory_order_acq_rel);
+			previous->next.store(p_node, std::memory_order_release);
+		}
+
+		void _recycle(Node* p_node)
+		{
+			p_node->nextFree = _freedHead;
+			if (_freedHead == nullptr)
+				_freedTail = p_node;
+			_freedHead = p_node;
+			_nbFreed++;
+
+			if (_nbFreed >= RecycleBatchSize)
+				_flushRecycledNodes();
+		}
+
+		void _flushRecycledNodes()
+		{
+			if (_freedHead == nullptr)
+				return;
+
+			Node* head = _recycledNodes.head.load(std::memory_order_relaxed);
+			do
+			{
+				_freedTail->nextFree = head;
+			} while (_recycledNodes.head.compare_exchange_weak(head, _freedHead, std::memory_order_release, std::memory_order_relaxed) == false);
+
+			_freedHead = nullptr;
+			_freedTail = nullptr;
+			_nbFreed = 0;
+		}
+
+		TType _popNext(Node* p_next)
+		{
+			TType result = std::move(*(p_next->value));
+			p_next->value.reset();
+
+			_recycle(_tail);
+			_tail = p_next;
+
+			return (result);
+		}
+
+	public:
+		MPSCQueue()
+		{
+			Node* stub = new Node();
+			_head.store(stub, std::memory_order_relaxed);
+			_tail = stub;
+		}
+
+		MPSCQueue(const MPSCQueue& p_other) = delete;
+		MPSCQueue& operator=(const MPSCQueue& p_other) = delete;
+
+		~MPSCQueue()
+		{
+			while (_tail != nullptr)
+			{
+				Node* next = _tail->next.load(std::memory_order_relaxed);
+				delete _tail;
+				_tail = next;
+			}
+			_deleteChain(_freedHead);
+		}
+
+		void push(TType&& p_item)
+		{
+			Node* node = _allocateNode();
+			node->value.emplace(std::move(p_item));
+			_pushNode(node);
+		}
+
+		void push(const TType& p_item)
+		{
+			Node* node = _allocateNode();
+			node->value.emplace(p_item);
+			_pushNode(node);
+		}
+
+		bool empty() const
+		{
+			return (_tail->next.load(std::memory_order_acquire) == nullptr);
+		}
+
+		bool tryPop(TType& p_item)
+		{
+			Node* next = _tail->next.load(std::memory_order_acquire);
+			if (next == nullptr)
+				return (false);
+
+			p_item = _popNext(next);
+			return (true);
+		}
+
+		template <typename TFunctor>
+		size_t drain(TFunctor&& p_functor)
+		{
+			size_t result = 0;
+
+			for (Node* next = _tail->next.load(std::memory_order_acquire); next != nullptr; next = _tail->next.load(std::memory_order_acquire))
+			{
+				p_functor(_popNext(next));
+				result++;
+			}
+
+			_flushRecycledNodes();
+			return (result);
+		}
+	};
+}
\ No newline at end of file
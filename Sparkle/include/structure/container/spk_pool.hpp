@@ -1,9 +1,15 @@
 #pragma once
 
-#include <deque>
-#include <memory>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <stdexcept>
+#include <utility>
 
 namespace spk
 {
@@ -15,24 +21,337 @@ namespace spk
 
 		using Cleaner = typename std::function<void(TType&)>;
 
+		static constexpr size_t MaxThreadSlot = 64;
+		static constexpr size_t BatchSize = 32;
+
 	private:
-		using Destructor = typename std::function<void(TType* p_toReturn)>;
+		static constexpr size_t CacheLineSize = 64;
+		static constexpr size_t FirstBlockSize = 64;
+		static constexpr size_t MaxBlock = 26;
+
+		struct Node
+		{
+			std::unique_ptr<TType> element = nullptr;
+			Pool* pool = nullptr;
+			Node* next = nullptr;
+			std::atomic<uint32_t> nextBatch = 0;
+			uint32_t index = 0;
+			uint32_t batchSize = 0;
+		};
+
+		struct alignas(CacheLineSize) Cache
+		{
+			Node* head = nullptr;
+			std::atomic<size_t> count = 0;
+		};
+
+		class ThreadSlot
+		{
+		private:
+			static inline std::atomic<uint64_t> _usedSlots = 0;
+			size_t _index = MaxThreadSlot;
+
+		public:
+			ThreadSlot()
+			{
+				uint64_t usedSlots = _usedSlots.load(std::memory_order_relaxed);
+				while (usedSlots != ~uint64_t(0))
+				{
+					size_t candidate = static_cast<size_t>(std::countr_one(usedSlots));
+					if (_usedSlots.compare_exchange_weak(usedSlots, usedSlots | (uint64_t(1) << candidate), std::memory_order_acquire, std::memory_order_relaxed))
+					{
+						_index = candidate;
+						break;
+					}
+				}
+			}
+
+			~ThreadSlot()
+			{
+				if (_index != MaxThreadSlot)
+					unclaim(_index);
+			}
+
+			size_t index() const
+			{
+				return (_index);
+			}
+
+			static bool tryClaim(size_t p_index)
+			{
+				uint64_t mask = uint64_t(1) << p_index;
+				return ((_usedSlots.fetch_or(mask, std::memory_order_acquire) & mask) == 0);
+			}
+
+			static void unclaim(size_t p_index)
+			{
+				_usedSlots.fetch_and(~(uint64_t(1) << p_index), std::memory_order_release);
+			}
+		};
+
+		static_assert(MaxThreadSlot <= 64, "Thread slots are tracked inside a 64 bits mask");
 
 	public:
-		using Object = typename std::unique_ptr<TType, Destructor>;
+		class Object
+		{
+			friend class Pool;
+
+		private:
+			Node* _node = nullptr;
+
+			explicit Object(Node* p_node) :
+				_node(p_node)
+			{
+
+			}
+
+		public:
+			Object() = default;
+
+			Object(std::nullptr_t)
+			{
+
+			}
+
+			Object(const Object& p_other) = delete;
+			Object& operator=(const Object& p_other) = delete;
+
+			Object(Object&& p_other) noexcept :
+				_node(std::exchange(p_other._node, nullptr))
+			{
+
+			}
+
+			Object& operator=(Object&& p_other) noexcept
+			{
+				if (this != &p_other)
+				{
+					reset();
+					_node = std::exchange(p_other._node, nullptr);
+				}
+				return (*this);
+			}
+
+			~Object()
+			{
+				reset();
+			}
+
+			void reset()
+			{
+				if (_node != nullptr)
+				{
+					_node->pool->_release(_node);
+					_node = nullptr;
+				}
+			}
+
+			TType* get() const
+			{
+				return (_node != nullptr ? _node->element.get() : nullptr);
+			}
+
+			TType& operator*() const
+			{
+				return (*get());
+			}
+
+			TType* operator->() const
+			{
+				return (get());
+			}
+
+			explicit operator bool() const
+			{
+				return (_node != nullptr);
+			}
+
+			bool operator==(std::nullptr_t) const
+			{
+				return (_node == nullptr);
+			}
+		};
+
+		static_assert(sizeof(Object) == sizeof(void*), "Pool::Object should stay pointer-sized");
 
 	private:
-		std::recursive_mutex _mutex;
 		Allocator _allocator;
 		Cleaner _cleaner;
-		std::deque<std::unique_ptr<TType>> _preallocatedElements;
 
-		const Destructor _destructorLambda = [&](TType* p_toReturn) { _insert(p_toReturn); };
+		std::mutex _growthMutex;
+		std::array<std::unique_ptr<Node[]>, MaxBlock> _ownedBlocks;
+		std::array<std::atomic<Node*>, MaxBlock> _blocks = {};
+		uint32_t _nbNode = 0;
+
+		alignas(CacheLineSize) std::atomic<uint64_t> _globalHead = 0;
+		std::atomic<size_t> _globalCount = 0;
 
-		void _insert(TType* p_toReturn)
+		std::array<Cache, MaxThreadSlot> _caches;
+
+		static uint32_t _headIndex(uint64_t p_head)
 		{
-			std::lock_guard<std::recursive_mutex> lock(_mutex);
-			_preallocatedElements.push_back(std::unique_ptr<TType>(p_toReturn));
+			return (static_cast<uint32_t>(p_head));
+		}
+
+		static uint64_t _packHead(uint64_t p_previousHead, uint32_t p_index)
+		{
+			return ((((p_previousHead >> 32) + 1) << 32) | p_index);
+		}
+
+		static Cache* _localCache(Pool& p_pool)
+		{
+			static thread_local ThreadSlot slot;
+
+			if (slot.index() == MaxThreadSlot)
+				return (nullptr);
+			return (&p_pool._caches[slot.index()]);
+		}
+
+		Node* _node(uint32_t p_index) const
+		{
+			size_t biased = static_cast<size_t>(p_index - 1) + FirstBlockSize;
+			size_t block = std::bit_width(biased) - std::bit_width(FirstBlockSize);
+			size_t offset = biased - (FirstBlockSize << block);
+
+			return (_blocks[block].load(std::memory_order_acquire) + offset);
+		}
+
+		Node* _createNode()
+		{
+			std::unique_ptr<TType> element(_allocator());
+
+			std::lock_guard<std::mutex> lock(_growthMutex);
+
+			if (_nbNode == UINT32_MAX)
+				throw std::runtime_error("Unable to allocate pool element, pool is full.");
+
+			uint32_t index = ++_nbNode;
+			size_t biased = static_cast<size_t>(index - 1) + FirstBlockSize;
+			size_t block = std::bit_width(biased) - std::bit_width(FirstBlockSize);
+
+			if (_ownedBlocks[block] == nullptr)
+			{
+				_ownedBlocks[block] = std::make_unique<Node[]>(FirstBlockSize << block);
+				_blocks[block].store(_ownedBlocks[block].get(), std::memory_order_release);
+			}
+
+			Node* result = _node(index);
+			result->element = std::move(element);
+			result->pool = this;
+			result->index = index;
+			return (result);
+		}
+
+		void _pushBatch(Node* p_first, uint32_t p_batchSize)
+		{
+			p_first->batchSize = p_batchSize;
+			_globalCount.fetch_add(p_batchSize, std::memory_order_relaxed);
+
+			uint64_t head = _globalHead.load(std::memory_order_relaxed);
+			do
+			{
+				p_first->nextBatch.store(_headIndex(head), std::memory_order_relaxed);
+			} while (_globalHead.compare_exchange_weak(head, _packHead(head, p_first->index), std::memory_order_release, std::memory_order_relaxed) == false);
+		}
+
+		Node* _popBatch()
+		{
+			uint64_t head = _globalHead.load(std::memory_order_acquire);
+			while (_headIndex(head) != 0)
+			{
+				Node* first = _node(_headIndex(head));
+				uint32_t nextBatch = first->nextBatch.load(std::memory_order_relaxed);
+
+				if (_globalHead.compare_exchange_weak(head, _packHead(head, nextBatch), std::memory_order_acquire, std::memory_order_acquire) == true)
+				{
+					_globalCount.fetch_sub(first->batchSize, std::memory_order_relaxed);
+					return (first);
+				}
+			}
+			return (nullptr);
+		}
+
+		bool _reclaimOrphanCaches()
+		{
+			bool result = false;
+
+			for (size_t i = 0; i < MaxThreadSlot; i++)
+			{
+				Cache& cache = _caches[i];
+				if (cache.count.load(std::memory_order_relaxed) == 0 || ThreadSlot::tryClaim(i) == false)
+					continue;
+
+				if (cache.head != nullptr)
+				{
+					_pushBatch(cache.head, static_cast<uint32_t>(cache.count.load(std::memory_order_relaxed)));
+					cache.head = nullptr;
+					cache.count.store(0, std::memory_order_relaxed);
+					result = true;
+				}
+
+				ThreadSlot::unclaim(i);
+			}
+
+			return (result);
+		}
+
+		Node* _acquire()
+		{
+			Cache* cache = _localCache(*this);
+
+			if (cache == nullptr)
+			{
+				Node* batch = _popBatch();
+				if (batch != nullptr && batch->next != nullptr)
+					_pushBatch(batch->next, batch->batchSize - 1);
+				return (batch);
+			}
+
+			if (cache->head == nullptr)
+			{
+				Node* batch = _popBatch();
+				if (batch == nullptr)
+					return (nullptr);
+				cache->head = batch;
+				cache->count.store(batch->batchSize, std::memory_order_relaxed);
+			}
+
+			Node* result = cache->head;
+			cache->head = result->next;
+			cache->count.store(cache->count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+			return (result);
+		}
+
+		void _release(Node* p_node)
+		{
+			Cache* cache = _localCache(*this);
+
+			if (cache == nullptr)
+			{
+				p_node->next = nullptr;
+				_pushBatch(p_node, 1);
+				return;
+			}
+
+			p_node->next = cache->head;
+			cache->head = p_node;
+			size_t count = cache->count.load(std::memory_order_relaxed) + 1;
+
+			if (count >= 2 * BatchSize)
+			{
+				Node* last = cache->head;
+				for (size_t i = 1; i < BatchSize; i++)
+					last = last->next;
+
+				Node* batch = cache->head;
+				cache->head = last->next;
+				last->next = nullptr;
+				count -= BatchSize;
+
+				_pushBatch(batch, static_cast<uint32_t>(BatchSize));
+			}
+
+			cache->count.store(count, std::memory_order_relaxed);
 		}
 
 	public:
@@ -50,6 +369,9 @@ namespace spk
 
 		}
 
+		Pool(const Pool& p_other) = delete;
+		Pool& operator=(const Pool& p_other) = delete;
+
 		void editAllocator(const Allocator& p_allocator)
 		{
 			_allocator = p_allocator;
@@ -62,37 +384,35 @@ namespace spk
 
 		void allocate()
 		{
-			_insert(_allocator());
+			_release(_createNode());
 		}
 
 		size_t size() const
 		{
-			return (_preallocatedElements.size());
+			size_t result = _globalCount.load(std::memory_order_relaxed);
+			for (const Cache& cache : _caches)
+				result += cache.count.load(std::memory_order_relaxed);
+			return (result);
 		}
 
 		void resize(size_t p_newSize)
 		{
-			std::lock_guard<std::recursive_mutex> lock(_mutex);
-
-			while (_preallocatedElements.size() < p_newSize)
-				_insert(_allocator());
+			for (size_t currentSize = size(); currentSize < p_newSize; currentSize++)
+				allocate();
 		}
 
 		Object obtain()
 		{
-			std::lock_guard<std::recursive_mutex> lock(_mutex);
-
-			if (_preallocatedElements.empty())
-			{
-				_insert(_allocator());
-			}
+			Node* node = _acquire();
 
-			Object item(_preallocatedElements.front().release(), _destructorLambda);
+			if (node == nullptr && _reclaimOrphanCaches() == true)
+				node = _acquire();
 
-			_preallocatedElements.pop_front();
+			if (node == nullptr)
+				node = _createNode();
 
-			_cleaner(*item);
-			return (std::move(item));
+			_cleaner(*(node->element));
+			return (Object(node));
 		}
 	};
 }
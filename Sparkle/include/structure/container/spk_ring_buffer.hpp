@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <utility>
+
+#include "structure/thread/spk_asymmetric_fence.hpp"
+
+namespace spk
+{
+	template <typename TType, size_t Capacity>
+	class RingBuffer
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+	private:
+		static constexpr size_t CacheLineSize = 64;
+		static constexpr size_t Mask = Capacity - 1;
+
+		struct alignas(CacheLineSize) ProducerSide
+		{
+			std::atomic<size_t> tail = 0;
+			size_t cachedHead = 0;
+		};
+
+		struct alignas(CacheLineSize) ConsumerSide
+		{
+			std::atomic<size_t> head = 0;
+			size_t cachedTail = 0;
+		};
+
+		ProducerSide _producer;
+		ConsumerSide _consumer;
+		alignas(CacheLineSize) std::atomic<uint32_t> _nbDataWaiter = 0;
+		alignas(CacheLineSize) std::atomic<uint32_t> _nbSpaceWaiter = 0;
+		alignas(CacheLineSize) std::byte _storage[sizeof(TType) * Capacity];
+
+		TType* _slot(size_t p_index)
+		{
+			return (std::launder(reinterpret_cast<TType*>(_storage + sizeof(TType) * (p_index & Mask))));
+		}
+
+		size_t _freeSpace(size_t p_tail, size_t p_wanted = 1)
+		{
+			if (Capacity - (p_tail - _producer.cachedHead) < p_wanted)
+				_producer.cachedHead = _consumer.head.load(std::memory_order_acquire);
+			return (Capacity - (p_tail - _producer.cachedHead));
+		}
+
+		size_t _available(size_t p_head, size_t p_wanted = 1)
+		{
+			if (_consumer.cachedTail - p_head < p_wanted)
+				_consumer.cachedTail = _producer.tail.load(std::memory_order_acquire);
+			return (_consumer.cachedTail - p_head);
+		}
+
+		// Waiter counters stay read-only for the other side until someone sleeps, and only that sleeper pays the heavy fence
+		void _publishTail(size_t p_tail)
+		{
+			_producer.tail.store(p_tail, std::memory_order_release);
+			spk::AsymmetricFence::light();
+			if (_nbDataWaiter.load(std::memory_order_relaxed) != 0)
+				_producer.tail.notify_one();
+		}
+
+		void _publishHead(size_t p_head)
+		{
+			_consumer.head.store(p_head, std::memory_order_release);
+			spk::AsymmetricFence::light();
+			if (_nbSpaceWaiter.load(std::memory_order_relaxed) != 0)
+				_consumer.head.notify_one();
+		}
+
+	public:
+		RingBuffer() = default;
+
+		RingBuffer(const RingBuffer& p_other) = delete;
+		RingBuffer& operator=(const RingBuffer& p_other) = delete;
+
+		~RingBuffer()
+		{
+			size_t tail = _producer.tail.load(std::memory_order_relaxed);
+			for (size_t head = _consumer.head.load(std::memory_order_relaxed); head != tail; head++)
+				_slot(head)->~TType();
+		}
+
+		static constexpr size_t capacity()
+		{
+			return (Capacity);
+		}
+
+		size_t size() const
+		{
+			return (_producer.tail.load(std::memory_order_acquire) - _consumer.head.load(std::memory_order_acquire));
+		}
+
+		bool empty() const
+		{
+			return (size() == 0);
+		}
+
+		template <typename... TArgs>
+		bool tryEmplace(TArgs&&... p_args)
+		{
+			size_t tail = _producer.tail.load(std::memory_order_relaxed);
+			if (_freeSpace(tail) == 0)
+				return (false);
+
+			new (_storage + sizeof(TType) * (tail & Mask)) TType(std::forward<TArgs>(p_args)...);
+			_publishTail(tail + 1);
+			return (true);
+		}
+
+		bool tryPush(const TType& p_item)
+		{
+			return (tryEmplace(p_item));
+		}
+
+		bool tryPush(TType&& p_item)
+		{
+			return (tryEmplace(std::move(p_item)));
+		}
+
+		bool tryPop(TType& p_item)
+		{
+			size_t head = _consumer.head.load(std::memory_order_relaxed);
+			if (_available(head) == 0)
+				return (false);
+
+			TType* slot = _slot(head);
+			p_item = std::move(*slot);
+			slot->~TType();
+			_publishHead(head + 1);
+			return (true);
+		}
+
+		size_t pushBatch(std::span<const TType> p_items)
+		{
+			size_t tail = _producer.tail.load(std::memory_order_relaxed);
+			size_t count = std::min(p_items.size(), _freeSpace(tail, p_items.size()));
+
+			for (size_t i = 0; i < count; i++)
+				new (_storage + sizeof(TType) * ((tail + i) & Mask)) TType(p_items[i]);
+
+			if (count != 0)
+				_publishTail(tail + count);
+			return (count);
+		}
+
+		size_t popBatch(std::span<TType> p_destination)
+		{
+			size_t head = _consumer.head.load(std::memory_order_relaxed);
+			size_t count = std::min(p_destination.size(), _available(head, p_destination.size()));
+
+			for (size_t i = 0; i < count; i++)
+			{
+				TType* slot = _slot(head + i);
+				p_destination[i] = std::move(*slot);
+				slot->~TType();
+			}
+
+			if (count != 0)
+				_publishHead(head + count);
+			return (count);
+		}
+
+		void waitForData()
+		{
+			size_t head = _consumer.head.load(std::memory_order_relaxed);
+			while (_available(head) == 0)
+			{
+				_nbDataWaiter.fetch_add(1, std::memory_order_relaxed);
+				spk::AsymmetricFence::heavy();
+				size_t tail = _producer.tail.load(std::memory_order_acquire);
+				if (tail == head)
+					_producer.tail.wait(tail, std::memory_order_acquire);
+				_nbDataWaiter.fetch_sub(1, std::memory_order_relaxed);
+			}
+		}
+
+		void waitForSpace()
+		{
+			size_t tail = _producer.tail.load(std::memory_order_relaxed);
+			while (_freeSpace(tail) == 0)
+			{
+				_nbSpaceWaiter.fetch_add(1, std::memory_order_relaxed);
+				spk::AsymmetricFence::heavy();
+				size_t head = _consumer.head.load(std::memory_order_acquire);
+				if (tail - head >= Capacity)
+					_consumer.head.wait(head, std::memory_order_acquire);
+				_nbSpaceWaiter.fetch_sub(1, std::memory_order_relaxed);
+			}
+		}
+
+		void push(TType&& p_item)
+		{
+			waitForSpace();
+			tryPush(std::move(p_item));
+		}
+
+		void push(const TType& p_item)
+		{
+			waitForSpace();
+			tryPush(p_item);
+		}
+
+		TType pop()
+		{
+			waitForData();
+
+			size_t head = _consumer.head.load(std::memory_order_relaxed);
+			TType* slot = _slot(head);
+			TType result = std::move(*slot);
+			slot->~TType();
+			_publishHead(head + 1);
+			return (result);
+		}
+	};
+}
\ No newline at end of file
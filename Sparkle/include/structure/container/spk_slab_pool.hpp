@@ -0,0 +1,230 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace spk
+{
+	// Iteration order is unspecified: release() moves the last element into the freed place
+	template<typename TType>
+	class SlabPool
+	{
+	public:
+		struct Handle
+		{
+			static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+			uint32_t index = InvalidIndex;
+			uint32_t generation = 0;
+
+			bool operator==(const Handle& p_other) const = default;
+		};
+
+		using Iterator = typename std::vector<TType>::iterator;
+		using ConstIterator = typename std::vector<TType>::const_iterator;
+
+	private:
+		struct Slot
+		{
+			uint32_t denseIndex = Handle::InvalidIndex;
+			uint32_t generation = 0;
+			uint32_t nextFree = Handle::InvalidIndex;
+		};
+
+		std::vector<TType> _elements;
+		std::vector<uint32_t> _denseToSlot;
+		std::vector<Slot> _slots;
+		uint32_t _firstFreeSlot = Handle::InvalidIndex;
+
+		const Slot* _slot(const Handle& p_handle) const
+		{
+			if (p_handle.index >= _slots.size())
+				return (nullptr);
+
+			const Slot& slot = _slots[p_handle.index];
+			if (slot.generation != p_handle.generation || slot.denseIndex == Handle::InvalidIndex)
+				return (nullptr);
+			return (&slot);
+		}
+
+	public:
+		SlabPool() = default;
+
+		SlabPool(size_t p_capacity)
+		{
+			reserve(p_capacity);
+		}
+
+		void reserve(size_t p_capacity)
+		{
+			_elements.reserve(p_capacity);
+			_denseToSlot.reserve(p_capacity);
+			_slots.reserve(p_capacity);
+		}
+
+		size_t size() const
+		{
+			return (_elements.size());
+		}
+
+		size_t capacity() const
+		{
+			return (_elements.capacity());
+		}
+
+		bool empty() const
+		{
+			return (_elements.empty());
+		}
+
+		template <typename... TArgs>
+		Handle obtain(TArgs&&... p_args)
+		{
+			uint32_t slotIndex = _firstFreeSlot;
+			bool isNewSlot = false;
+
+			if (slotIndex == Handle::InvalidIndex && _slots.size() >= Handle::InvalidIndex)
+				throw std::runtime_error("Unable to obtain slab element, pool is full.");
+
+			_elements.emplace_back(std::forward<TArgs>(p_args)...);
+
+			try
+			{
+				if (slotIndex == Handle::InvalidIndex)
+				{
+					slotIndex = static_cast<uint32_t>(_slots.size());
+					_slots.emplace_back();
+					isNewSlot = true;
+				}
+				_denseToSlot.push_back(slotIndex);
+			}
+			catch (...)
+			{
+				if (isNewSlot == true)
+					_slots.pop_back();
+				_elements.pop_back();
+				throw;
+			}
+
+			Slot& slot = _slots[slotIndex];
+			if (isNewSlot == false)
+				_firstFreeSlot = slot.nextFree;
+			slot.denseIndex = static_cast<uint32_t>(_elements.size() - 1);
+			slot.nextFree = Handle::InvalidIndex;
+
+			return (Handle{ slotIndex, slot.generation });
+		}
+
+		void release(const Handle& p_handle)
+		{
+			if (_slot(p_handle) == nullptr)
+				throw std::runtime_error("Unable to release slab element, handle is no longer valid.");
+
+			Slot& slot = _slots[p_handle.index];
+			uint32_t denseIndex = slot.denseIndex;
+			uint32_t lastIndex = static_cast<uint32_t>(_elements.size() - 1);
+
+			if (denseIndex != lastIndex)
+			{
+				_elements[denseIndex] = std::move(_elements[lastIndex]);
+				_denseToSlot[denseIndex] = _denseToSlot[lastIndex];
+				_slots[_denseToSlot[denseIndex]].denseIndex = denseIndex;
+			}
+			_elements.pop_back();
+			_denseToSlot.pop_back();
+
+			slot.denseIndex = Handle::InvalidIndex;
+			slot.generation++;
+			slot.nextFree = _firstFreeSlot;
+			_firstFreeSlot = p_handle.index;
+		}
+
+		void clear()
+		{
+			for (uint32_t slotIndex : _denseToSlot)
+			{
+				Slot& slot = _slots[slotIndex];
+				slot.denseIndex = Handle::InvalidIndex;
+				slot.generation++;
+				slot.nextFree = _firstFreeSlot;
+				_firstFreeSlot = slotIndex;
+			}
+			_elements.clear();
+			_denseToSlot.clear();
+		}
+
+		bool contains(const Handle& p_handle) const
+		{
+			return (_slot(p_handle) != nullptr);
+		}
+
+		TType* get(const Handle& p_handle)
+		{
+			const Slot* slot = _slot(p_handle);
+			return (slot != nullptr ? &(_elements[slot->denseIndex]) : nullptr);
+		}
+
+		const TType* get(const Handle& p_handle) const
+		{
+			const Slot* slot = _slot(p_handle);
+			return (slot != nullptr ? &(_elements[slot->denseIndex]) : nullptr);
+		}
+
+		TType& operator[](const Handle& p_handle)
+		{
+			TType* result = get(p_handle);
+			if (result == nullptr)
+				throw std::runtime_error("Unable to access slab element, handle is no longer valid.");
+			return (*result);
+		}
+
+		const TType& operator[](const Handle& p_handle) const
+		{
+			const TType* result = get(p_handle);
+			if (result == nullptr)
+				throw std::runtime_error("Unable to access slab element, handle is no longer valid.");
+			return (*result);
+		}
+
+		Handle handle(size_t p_denseIndex) const
+		{
+			if (p_denseIndex >= _elements.size())
+				throw std::runtime_error("Unable to build slab handle, index is out of bound.");
+			uint32_t slotIndex = _denseToSlot[p_denseIndex];
+			return (Handle{ slotIndex, _slots[slotIndex].generation });
+		}
+
+		TType* data()
+		{
+			return (_elements.data());
+		}
+
+		const TType* data() const
+		{
+			return (_elements.data());
+		}
+
+		Iterator begin()
+		{
+			return (_elements.begin());
+		}
+
+		Iterator end()
+		{
+			return (_elements.end());
+		}
+
+		ConstIterator begin() const
+		{
+			return (_elements.begin());
+		}
+
+		ConstIterator end() const
+		{
+			return (_elements.end());
+		}
+	};
+}
\ No newline at end of file
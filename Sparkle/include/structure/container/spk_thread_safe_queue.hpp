@@ -3,6 +3,8 @@
 #include <queue>
 #include <mutex>
 #include <condition_variable>
+#include <chrono>
+#include <stdexcept>
 
 namespace spk
 {
@@ -11,33 +13,128 @@ namespace spk
     {
     private:
         std::queue<TType> m_queue;
-        std::mutex m_mutex;
+        mutable std::mutex m_mutex;
         std::condition_variable m_cond;
+        bool m_closed = false;
+
+        TType _popFront()
+        {
+            TType item = std::move(m_queue.front());
+            m_queue.pop();
+
+            return (item);
+        }
 
     public:
         bool empty() const
-        {	
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
             return (m_queue.empty());
         }
 
+        size_t size() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            return (m_queue.size());
+        }
+
+        bool isClosed() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            return (m_closed);
+        }
+
 		void push(TType&& item)
 		{
 			std::unique_lock<std::mutex> lock(m_mutex);
 
+			if (m_closed == true)
+				throw std::runtime_error("Unable to push into a closed queue.");
+
 			m_queue.push(std::move(item));
 			m_cond.notify_one();
 		}
 
+		void push(const TType& item)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			if (m_closed == true)
+				throw std::runtime_error("Unable to push into a closed queue.");
+
+			m_queue.push(item);
+			m_cond.notify_one();
+		}
+
         TType pop()
         {
             std::unique_lock<std::mutex> lock(m_mutex);
 
-            m_cond.wait(lock, [&]() { return !m_queue.empty(); });
+            m_cond.wait(lock, [&]() { return (!m_queue.empty() || m_closed); });
 
-            TType item = m_queue.front();
-            m_queue.pop();
+            if (m_queue.empty())
+                throw std::runtime_error("Unable to pop from a closed and empty queue.");
+
+            return (_popFront());
+        }
+
+        bool tryPop(TType& p_item)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            if (m_queue.empty())
+                return (false);
+
+            p_item = _popFront();
+            return (true);
+        }
+
+        template <typename TRep, typename TPeriod>
+        bool popFor(TType& p_item, const std::chrono::duration<TRep, TPeriod>& p_timeout)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            if (m_cond.wait_for(lock, p_timeout, [&]() { return (!m_queue.empty() || m_closed); }) == false || m_queue.empty())
+                return (false);
+
+            p_item = _popFront();
+            return (true);
+        }
+
+        template <typename TContainer>
+        size_t drainInto(TContainer& p_container)
+        {
+            std::queue<TType> drained;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                if (m_queue.empty())
+                    return (0);
+
+                std::swap(drained, m_queue);
+            }
+
+            size_t result = drained.size();
+            while (drained.empty() == false)
+            {
+                p_container.push_back(std::move(drained.front()));
+                drained.pop();
+            }
+            return (result);
+        }
+
+        void close()
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
 
-            return std::move(item);
+                m_closed = true;
+            }
+            m_cond.notify_all();
         }
     };
 }
\ No newline at end of file
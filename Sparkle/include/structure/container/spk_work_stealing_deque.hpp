@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace spk
+{
+	template <typename TType>
+	class WorkStealingDeque
+	{
+		static_assert(std::is_trivially_copyable_v<TType>, "WorkStealingDeque only stores trivially copyable elements");
+
+	private:
+		static constexpr size_t CacheLineSize = 64;
+		static constexpr int64_t DefaultCapacity = 256;
+
+		class Array
+		{
+		private:
+			int64_t _capacity;
+			int64_t _mask;
+			std::unique_ptr<std::atomic<TType>[]> _elements;
+
+		public:
+			Array(int64_t p_capacity) :
+				_capacity(p_capacity),
+				_mask(p_capacity - 1),
+				_elements(std::make_unique<std::atomic<TType>[]>(static_cast<size_t>(p_capacity)))
+			{
+
+			}
+
+			int64_t capacity() const
+			{
+				return (_capacity);
+			}
+
+			TType get(int64_t p_index) const
+			{
+				return (_elements[p_index & _mask].load(std::memory_order_relaxed));
+			}
+
+			void put(int64_t p_index, TType p_value)
+			{
+				_elements[p_index & _mask].store(p_value, std::memory_order_relaxed);
+			}
+
+			std::unique_ptr<Array> grow(int64_t p_top, int64_t p_bottom) const
+			{
+				std::unique_ptr<Array> result = std::make_unique<Array>(_capacity * 2);
+				for (int64_t i = p_top; i < p_bottom; i++)
+					result->put(i, get(i));
+				return (result);
+			}
+		};
+
+		alignas(CacheLineSize) std::atomic<int64_t> _top = 0;
+		alignas(CacheLineSize) std::atomic<int64_t> _bottom = 0;
+		alignas(CacheLineSize) std::atomic<Array*> _array;
+		std::vector<std::unique_ptr<Array>> _arrays;
+
+	public:
+		WorkStealingDeque(size_t p_capacity = DefaultCapacity)
+		{
+			int64_t capacity = 2;
+			while (capacity < static_cast<int64_t>(p_capacity))
+				capacity *= 2;
+
+			_arrays.push_back(std::make_unique<Array>(capacity));
+			_array.store(_arrays.back().get(), std::memory_order_relaxed);
+		}
+
+		WorkStealingDeque(const WorkStealingDeque& p_other) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque& p_other) = delete;
+
+		void push(TType p_value)
+		{
+			int64_t bottom = _bottom.load(std::memory_order_relaxed);
+			int64_t top = _top.load(std::memory_order_acquire);
+			Array* array = _array.load(std::memory_order_relaxed);
+
+			if (bottom - top > array->capacity() - 1)
+			{
+				_arrays.push_back(array->grow(top, bottom));
+				array = _arrays.back().get();
+				_array.store(array, std::memory_order_release);
+			}
+
+			array->put(bottom, p_value);
+			std::atomic_thread_fence(std::memory_order_release);
+			_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		std::optional<TType> pop()
+		{
+			int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+			Array* array = _array.load(std::memory_order_relaxed);
+			_bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = _top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return (std::nullopt);
+			}
+
+			TType result = array->get(bottom);
+			if (top == bottom)
+			{
+				bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+				if (won == false)
+					return (std::nullopt);
+			}
+			return (result);
+		}
+
+		std::optional<TType> steal()
+		{
+			int64_t top = _top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return (std::nullopt);
+
+			Array* array = _array.load(std::memory_order_acquire);
+			TType result = array->get(top);
+			if (_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) == false)
+				return (std::nullopt);
+			return (result);
+		}
+
+		size_t size() const
+		{
+			int64_t bottom = _bottom.load(std::memory_order_relaxed);
+			int64_t top = _top.load(std::memory_order_relaxed);
+			return (bottom > top ? static_cast<size_t>(bottom - top) : 0);
+		}
+
+		bool empty() const
+		{
+			return (size() == 0);
+		}
+
+		size_t capacity() const
+		{
+			return (static_cast<size_t>(_array.load(std::memory_order_relaxed)->capacity()));
+		}
+	};
+}
\ No newline at end of file
@@ -4,37 +4,93 @@
 #include <memory>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <mutex>
+#include <stdexcept>
+#include <type_traits>
+
+#include "structure/spk_inplace_function.hpp"
 
 namespace spk
 {
-	class ContractProvider
+	template <typename... TParameterTypes>
+	class TContractProvider;
+
+	// Value parameters reach every subscriber by const reference, reference parameters are kept as declared
+	template <typename TType>
+	using ContractParameter = std::conditional_t<std::is_reference_v<TType>, TType, const TType&>;
+
+	class IContractProvider
 	{
 	public:
+		static constexpr size_t JobCapacity = 64;
+
+	protected:
+		struct ISubscription
+		{
+			std::atomic<bool> isActive = true;
+			std::atomic<uint32_t> nbRunning = 0;
+			std::atomic<bool> isWaited = false;
+
+			virtual ~ISubscription() = default;
+		};
+
+		// Jobs currently executed by this thread, innermost first, so a job resigning itself does not wait for its own call
+		struct RunningJob
+		{
+			const ISubscription* subscription;
+			const RunningJob* previous;
+		};
+
+		static inline thread_local const RunningJob* _runningJobs = nullptr;
+
+		static void _waitRunningJobs(ISubscription& p_subscription)
+		{
+			uint32_t nbOwnCall = 0;
+			for (const RunningJob* runningJob = _runningJobs; runningJob != nullptr; runningJob = runningJob->previous)
+			{
+				if (runningJob->subscription == &p_subscription)
+					nbOwnCall++;
+			}
+
+			p_subscription.isWaited.store(true, std::memory_order_seq_cst);
+			uint32_t nbRunning = p_subscription.nbRunning.load(std::memory_order_seq_cst);
+			while (nbRunning > nbOwnCall)
+			{
+				p_subscription.nbRunning.wait(nbRunning, std::memory_order_seq_cst);
+				nbRunning = p_subscription.nbRunning.load(std::memory_order_seq_cst);
+			}
+		}
+
+	public:
+		// Resigning, or destroying, a contract returns once no other thread is still running its job,
+		// so the owner of the job can be destroyed right after. A job may resign its own contract.
 		class Contract
 		{
-			friend class ContractProvider;
-		public:
-			using Job = std::function<void()>;
+			template <typename... TParameterTypes>
+			friend class TContractProvider;
 
 		private:
-			std::shared_ptr<Job> _job = nullptr;
-			ContractProvider* _originator = nullptr;
+			std::shared_ptr<ISubscription> _subscription = nullptr;
+			IContractProvider* _originator = nullptr;
 
-			Contract(ContractProvider* p_originator, const std::shared_ptr<Job>& p_job) :
-				_originator(p_originator),
-				_job(p_job)
+			Contract(IContractProvider* p_originator, const std::shared_ptr<ISubscription>& p_subscription) :
+				_subscription(p_subscription),
+				_originator(p_originator)
 			{
 
 			}
 
 		public:
+			Contract() = default;
+
 			Contract(const Contract& p_other) = delete;
 			Contract& operator =(const Contract& p_other) = delete;
 
 			Contract(Contract&& p_other) = default;
 			Contract& operator =(Contract&& p_other) = default;
-		
+
 			~Contract()
 			{
 				if (isValid() == true)
@@ -45,7 +101,7 @@ namespace spk
 
 			bool isValid()
 			{
-				return (!(_job == nullptr || *_job == nullptr));
+				return (_subscription != nullptr && _subscription->isActive.load(std::memory_order_acquire) == true);
 			}
 
 			void resign()
@@ -53,9 +109,8 @@ namespace spk
 				if (isValid() == false)
 					throw std::runtime_error("Can't resign an already resigned contract");
 
-				*_job = nullptr;
 				_originator->unsubscribe(*this);
-				_job = nullptr;
+				_subscription = nullptr;
 			}
 
 			void relinquish()
@@ -64,74 +119,262 @@ namespace spk
 					throw std::runtime_error("Can't relinquish an already resigned contract");
 
 				_originator->relinquish(std::move(*this));
-				_job = nullptr;
+				_subscription = nullptr;
 				_originator = nullptr;
 			}
 		};
-		using Job = Contract::Job;
+
+		virtual ~IContractProvider() = default;
+
+		virtual void invalidateContracts() = 0;
+		virtual void relinquish(Contract&& p_contract) = 0;
+		virtual void unsubscribe(const Contract& p_contract) = 0;
+	};
+
+	template <typename... TParameterTypes>
+	class TContractProvider : public IContractProvider
+	{
+	public:
+		using Job = spk::InplaceFunction<void(spk::ContractParameter<TParameterTypes>...), JobCapacity, true>;
+		using Contract = IContractProvider::Contract;
+
+	private:
+		struct Subscription : public ISubscription
+		{
+			Job job;
+
+			Subscription(Job&& p_job) :
+				job(std::move(p_job))
+			{
+
+			}
+		};
+
+		struct Snapshot
+		{
+			std::vector<std::shared_ptr<Subscription>> subscriptions;
+		};
 
 	private:
-		std::vector<std::shared_ptr<Job>> _subscribedJobs;
+		class ReaderGuard
+		{
+		private:
+			TContractProvider& _provider;
+
+		public:
+			ReaderGuard(TContractProvider& p_provider) :
+				_provider(p_provider)
+			{
+				_provider._nbReader.fetch_add(1, std::memory_order_seq_cst);
+			}
+
+			~ReaderGuard()
+			{
+				if (_provider._nbReader.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+					_provider._hasRetiredSnapshot.load(std::memory_order_seq_cst) == true)
+					_provider._tryReclaimSnapshots();
+			}
+		};
+
+		// Counts a job as running before its last activity check, so unsubscribe can wait for it to return
+		class RunningGuard
+		{
+		private:
+			ISubscription& _subscription;
+			RunningJob _runningJob;
+
+		public:
+			RunningGuard(ISubscription& p_subscription) :
+				_subscription(p_subscription),
+				_runningJob{ &p_subscription, _runningJobs }
+			{
+				_subscription.nbRunning.fetch_add(1, std::memory_order_seq_cst);
+				_runningJobs = &_runningJob;
+			}
+
+			~RunningGuard()
+			{
+				_runningJobs = _runningJob.previous;
+				if (_subscription.nbRunning.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+					_subscription.isWaited.load(std::memory_order_seq_cst) == true)
+					_subscription.nbRunning.notify_all();
+			}
+		};
+
+		std::atomic<Snapshot*> _snapshot = nullptr;
+		std::atomic<size_t> _nbReader = 0;
+		std::atomic<bool> _hasRetiredSnapshot = false;
+
+		std::mutex _mutex;
+		std::vector<std::unique_ptr<Snapshot>> _retiredSnapshots;
 		std::vector<Contract> _relinquishedContracts;
-		std::recursive_mutex _mutex;
+
+		using Garbage = std::vector<std::unique_ptr<Snapshot>>;
+
+		void _publish(std::unique_ptr<Snapshot> p_snapshot, Garbage& p_garbage)
+		{
+			Snapshot* previous = _snapshot.exchange(p_snapshot.release(), std::memory_order_seq_cst);
+
+			if (previous != nullptr)
+			{
+				_retiredSnapshots.emplace_back(previous);
+				_hasRetiredSnapshot.store(true, std::memory_order_seq_cst);
+			}
+
+			_collectRetiredSnapshots(p_garbage);
+		}
+
+		void _collectRetiredSnapshots(Garbage& p_garbage)
+		{
+			if (_nbReader.load(std::memory_order_seq_cst) == 0)
+			{
+				p_garbage.swap(_retiredSnapshots);
+				_hasRetiredSnapshot.store(false, std::memory_order_relaxed);
+			}
+		}
+
+		void _tryReclaimSnapshots()
+		{
+			Garbage garbage;
+			std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+
+			if (lock.owns_lock() == true)
+				_collectRetiredSnapshots(garbage);
+		}
+
+		Contract _subscribe(Job&& p_job)
+		{
+			std::shared_ptr<Subscription> toAdd = std::make_shared<Subscription>(std::move(p_job));
+
+			Garbage garbage;
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			std::unique_ptr<Snapshot> snapshot = std::make_unique<Snapshot>();
+			Snapshot* current = _snapshot.load(std::memory_order_acquire);
+			if (current != nullptr)
+			{
+				snapshot->subscriptions.reserve(current->subscriptions.size() + 1);
+				snapshot->subscriptions = current->subscriptions;
+			}
+			snapshot->subscriptions.push_back(toAdd);
+			_publish(std::move(snapshot), garbage);
+
+			return (Contract(this, toAdd));
+		}
 
 	public:
-		ContractProvider()
+		TContractProvider()
 		{
 
 		}
 
-		~ContractProvider()
+		TContractProvider(const TContractProvider& p_other) = delete;
+		TContractProvider& operator =(const TContractProvider& p_other) = delete;
+
+		~TContractProvider()
 		{
 			invalidateContracts();
+
+			Garbage garbage;
+			std::vector<Contract> relinquishedContracts;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				relinquishedContracts = std::move(_relinquishedContracts);
+				garbage = std::move(_retiredSnapshots);
+			}
+			delete _snapshot.exchange(nullptr);
 		}
 
-		void invalidateContracts()
+		void invalidateContracts() override
 		{
-			for (auto& job : _subscribedJobs)
+			Garbage garbage;
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			Snapshot* current = _snapshot.load(std::memory_order_acquire);
+			if (current == nullptr)
+				return;
+
+			for (auto& subscription : current->subscriptions)
 			{
-				*job = nullptr;
+				subscription->isActive.store(false, std::memory_order_release);
 			}
-			_subscribedJobs.clear();
+			_publish(nullptr, garbage);
 		}
 
-		Contract subscribe(const Job& p_job)
+		template <typename TCallable>
+		Contract subscribe(TCallable&& p_job)
 		{
-			std::shared_ptr<Job> toAdd = std::make_shared<Job>(p_job);
+			using Callable = std::decay_t<TCallable>;
 
-			std::lock_guard<std::recursive_mutex> lock(_mutex);
-			_subscribedJobs.push_back(toAdd);
+			if constexpr (std::is_invocable_v<Callable&, spk::ContractParameter<TParameterTypes>...>)
+			{
+				return (_subscribe(Job(std::forward<TCallable>(p_job))));
+			}
+			else
+			{
+				static_assert(std::is_invocable_v<Callable&>, "A contract job must accept either the provider parameters or no parameter");
 
-			return (Contract(this, toAdd));
+				return (_subscribe(Job([job = Callable(std::forward<TCallable>(p_job))](spk::ContractParameter<TParameterTypes>...) mutable { job(); })));
+			}
 		}
 
-		void relinquish(Contract&& p_contract)
+		void relinquish(Contract&& p_contract) override
 		{
-			std::lock_guard<std::recursive_mutex> lock(_mutex);
+			std::lock_guard<std::mutex> lock(_mutex);
 			_relinquishedContracts.push_back(std::move(p_contract));
 		}
 
-		void unsubscribe(const Contract& p_contract)
+		void unsubscribe(const Contract& p_contract) override
 		{
-			std::lock_guard<std::recursive_mutex> lock(_mutex);
-			auto it = std::remove(_subscribedJobs.begin(), _subscribedJobs.end(), p_contract._job);
-			if (it != _subscribedJobs.end())
+			if (p_contract._subscription == nullptr)
+				return;
+
+			p_contract._subscription->isActive.store(false, std::memory_order_seq_cst);
+			_waitRunningJobs(*p_contract._subscription);
+
+			Garbage garbage;
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			Snapshot* current = _snapshot.load(std::memory_order_acquire);
+			if (current == nullptr)
+				return;
+
+			auto it = std::find_if(current->subscriptions.begin(), current->subscriptions.end(), [&](const std::shared_ptr<Subscription>& p_subscription) {
+					return (p_subscription.get() == p_contract._subscription.get());
+				});
+			if (it == current->subscriptions.end())
+				return;
+
+			std::unique_ptr<Snapshot> snapshot = nullptr;
+			if (current->subscriptions.size() > 1)
 			{
-				std::shared_ptr<Job> tmp = *it;
-				_subscribedJobs.erase(it, _subscribedJobs.end());
-				if (tmp != nullptr)
-					*tmp = nullptr;
+				snapshot = std::make_unique<Snapshot>();
+				snapshot->subscriptions.reserve(current->subscriptions.size() - 1);
+				snapshot->subscriptions.insert(snapshot->subscriptions.end(), current->subscriptions.begin(), it);
+				snapshot->subscriptions.insert(snapshot->subscriptions.end(), it + 1, current->subscriptions.end());
 			}
+			_publish(std::move(snapshot), garbage);
 		}
 
-		void trigger()
+		void trigger(spk::ContractParameter<TParameterTypes>... p_args)
 		{
-			std::lock_guard<std::recursive_mutex> lock(_mutex);
-			for (auto& job : _subscribedJobs)
+			ReaderGuard guard(*this);
+
+			Snapshot* snapshot = _snapshot.load(std::memory_order_seq_cst);
+			if (snapshot == nullptr)
+				return;
+
+			for (const auto& subscription : snapshot->subscriptions)
 			{
-				if (job != nullptr)
-					(*job)();
+				if (subscription->isActive.load(std::memory_order_relaxed) == false)
+					continue;
+
+				RunningGuard runningGuard(*subscription);
+				if (subscription->isActive.load(std::memory_order_seq_cst) == true)
+					subscription->job(p_args...);
 			}
 		}
 	};
+
+	using ContractProvider = TContractProvider<>;
 }
\ No newline at end of file
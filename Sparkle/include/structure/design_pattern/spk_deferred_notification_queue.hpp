@@ -0,0 +1,222 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace spk
+{
+	class DeferredNotificationQueue
+	{
+	public:
+		class INotifiable;
+
+	private:
+		// Shared by the queue and its notifiable, so either side can give up the request without touching the other one
+		struct Entry
+		{
+			static constexpr uint32_t Pending = 0;
+			static constexpr uint32_t FlushingFlag = 1 << 0;
+			static constexpr uint32_t FinishedFlag = 1 << 1;
+			static constexpr uint32_t WaitedFlag = 1 << 2;
+
+			INotifiable* notifiable;
+			DeferredNotificationQueue* queue;
+			std::atomic<uint32_t> state = Pending;
+			std::atomic<uint32_t> nbReference = 2;
+
+			Entry(INotifiable* p_notifiable, DeferredNotificationQueue* p_queue) :
+				notifiable(p_notifiable),
+				queue(p_queue)
+			{
+
+			}
+
+			bool isPending() const
+			{
+				return (state.load(std::memory_order_acquire) == Pending);
+			}
+
+			bool cancel()
+			{
+				uint32_t expected = Pending;
+				return (state.compare_exchange_strong(expected, FinishedFlag, std::memory_order_acq_rel, std::memory_order_acquire));
+			}
+
+			void release()
+			{
+				if (nbReference.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					delete this;
+			}
+
+			void finish()
+			{
+				if ((state.exchange(FinishedFlag, std::memory_order_acq_rel) & WaitedFlag) != 0)
+					state.notify_all();
+			}
+		};
+
+	public:
+		class INotifiable
+		{
+			friend class DeferredNotificationQueue;
+
+		private:
+			Entry* _entry = nullptr;
+
+			virtual void _flushNotification() = 0;
+
+		protected:
+			bool isPending() const
+			{
+				return (_entry != nullptr && _entry->isPending() == true);
+			}
+
+			void requestNotification()
+			{
+				if (isPending() == true)
+					return;
+
+				if (_entry != nullptr)
+					_entry->release();
+				_entry = DeferredNotificationQueue::local()._enqueue(this);
+			}
+
+			// Waits for a flush running on another thread, so the notifiable can be destroyed right after
+			void cancelNotification()
+			{
+				if (_entry == nullptr)
+					return;
+
+				if (_entry->cancel() == false && _entry->queue != _flushingQueue)
+				{
+					uint32_t state = _entry->state.fetch_or(Entry::WaitedFlag, std::memory_order_acq_rel) | Entry::WaitedFlag;
+					while ((state & Entry::FlushingFlag) != 0)
+					{
+						_entry->state.wait(state, std::memory_order_acquire);
+						state = _entry->state.load(std::memory_order_acquire);
+					}
+				}
+
+				_entry->release();
+				_entry = nullptr;
+			}
+
+		public:
+			virtual ~INotifiable()
+			{
+				cancelNotification();
+			}
+		};
+
+	private:
+		static inline thread_local DeferredNotificationQueue* _flushingQueue = nullptr;
+
+		std::vector<Entry*> _pendingEntries;
+		std::vector<Entry*> _flushingEntries;
+		bool _isFlushing = false;
+
+		Entry* _enqueue(INotifiable* p_notifiable)
+		{
+			Entry* result = new Entry(p_notifiable, this);
+			_pendingEntries.push_back(result);
+			return (result);
+		}
+
+	public:
+		DeferredNotificationQueue() = default;
+
+		DeferredNotificationQueue(const DeferredNotificationQueue& p_other) = delete;
+		DeferredNotificationQueue& operator =(const DeferredNotificationQueue& p_other) = delete;
+
+		~DeferredNotificationQueue()
+		{
+			for (Entry* entry : _pendingEntries)
+			{
+				entry->cancel();
+				entry->release();
+			}
+		}
+
+		static DeferredNotificationQueue& local()
+		{
+			static thread_local DeferredNotificationQueue result;
+
+			return (result);
+		}
+
+		size_t size() const
+		{
+			return (_pendingEntries.size());
+		}
+
+		bool empty() const
+		{
+			return (_pendingEntries.empty());
+		}
+
+		// Restores the queue when a notification throws, keeping the entries not flushed yet for the next flush
+		class FlushGuard
+		{
+		private:
+			DeferredNotificationQueue& _queue;
+			DeferredNotificationQueue* _previousFlushingQueue;
+			const size_t& _index;
+
+		public:
+			FlushGuard(DeferredNotificationQueue& p_queue, const size_t& p_index) :
+				_queue(p_queue),
+				_previousFlushingQueue(std::exchange(_flushingQueue, &p_queue)),
+				_index(p_index)
+			{
+				_queue._isFlushing = true;
+			}
+
+			FlushGuard(const FlushGuard& p_other) = delete;
+			FlushGuard& operator =(const FlushGuard& p_other) = delete;
+
+			~FlushGuard()
+			{
+				std::vector<Entry*>& entries = _queue._flushingEntries;
+
+				if (_index < entries.size())
+				{
+					entries[_index]->finish();
+					entries[_index]->release();
+					_queue._pendingEntries.insert(_queue._pendingEntries.begin(), entries.begin() + _index + 1, entries.end());
+				}
+				entries.clear();
+				_queue._isFlushing = false;
+				_flushingQueue = _previousFlushingQueue;
+			}
+		};
+
+		size_t flush()
+		{
+			size_t result = 0;
+
+			if (_isFlushing == true)
+				return (result);
+
+			size_t index = 0;
+			FlushGuard guard(*this, index);
+
+			_flushingEntries.swap(_pendingEntries);
+			for (; index < _flushingEntries.size(); index++)
+			{
+				Entry* entry = _flushingEntries[index];
+				uint32_t expected = Entry::Pending;
+				if (entry->state.compare_exchange_strong(expected, Entry::FlushingFlag, std::memory_order_acq_rel, std::memory_order_acquire) == true)
+				{
+					entry->notifiable->_flushNotification();
+					entry->finish();
+					result++;
+				}
+				entry->release();
+			}
+
+			return (result);
+		}
+	};
+}
\ No newline at end of file
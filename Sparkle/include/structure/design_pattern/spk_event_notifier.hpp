@@ -1,41 +1,135 @@
 #pragma once
 
 #include "structure/design_pattern/spk_contract_provider.hpp"
-#include <map>
+#include "structure/container/spk_flat_hash_map.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
 
 namespace spk
 {
-	template<typename TType>
+	// Number of enum values an EventNotifier dispatches through its dense table, specialize it for enums with more values
+	template <typename TType, typename = void>
+	struct EventNotifierDenseSize
+	{
+		static constexpr size_t value = 0;
+	};
+
+	template <typename TType>
+	struct EventNotifierDenseSize<TType, std::enable_if_t<std::is_enum_v<TType>>>
+	{
+		static constexpr size_t value = (sizeof(std::underlying_type_t<TType>) == 1 ? 256 : 64);
+	};
+
+	template<typename TType, typename... TPayloadTypes>
 	class EventNotifier
 	{
+	public:
+		using ContractProvider = spk::TContractProvider<TPayloadTypes...>;
+		using Contract = typename ContractProvider::Contract;
+		using Job = typename ContractProvider::Job;
+
+		static constexpr bool IsDense = std::is_enum_v<TType>;
+		static constexpr size_t DenseSize = spk::EventNotifierDenseSize<TType>::value;
+
 	private:
-		std::map<TType, ContractProvider> _eventProviders;
+		template <typename TEnum, bool = std::is_enum_v<TEnum>>
+		struct DenseIndex
+		{
+			using Type = size_t;
+		};
+
+		template <typename TEnum>
+		struct DenseIndex<TEnum, true>
+		{
+			using Type = std::make_unsigned_t<std::underlying_type_t<TEnum>>;
+		};
+
+		using DenseIndexType = typename DenseIndex<TType>::Type;
+
+		// Every value of the enum fits in the table, so dense lookups need no range check
+		static constexpr bool IsFullyDense = IsDense && DenseSize != 0 && static_cast<uint64_t>(std::numeric_limits<DenseIndexType>::max()) < DenseSize;
+
+		std::array<std::unique_ptr<ContractProvider>, DenseSize> _denseProviders;
+		spk::FlatHashMap<TType, std::unique_ptr<ContractProvider>> _sparseProviders;
+
+		// Negative values wrap to large indexes, which fall back to the sparse table
+		static size_t _denseIndex(const TType& p_event)
+		{
+			return (static_cast<size_t>(static_cast<DenseIndexType>(p_event)));
+		}
+
+		ContractProvider* _provider(const TType& p_event)
+		{
+			if constexpr (IsFullyDense == true)
+			{
+				return (_denseProviders[_denseIndex(p_event)].get());
+			}
+			else
+			{
+				if constexpr (IsDense == true && DenseSize != 0)
+				{
+					size_t index = _denseIndex(p_event);
+					if (index < DenseSize)
+						return (_denseProviders[index].get());
+				}
+
+				std::unique_ptr<ContractProvider>* result = _sparseProviders.find(p_event);
+				return (result != nullptr ? result->get() : nullptr);
+			}
+		}
+
+		ContractProvider& _obtainProvider(const TType& p_event)
+		{
+			std::unique_ptr<ContractProvider>* slot = nullptr;
+
+			if constexpr (IsDense == true && DenseSize != 0)
+			{
+				size_t index = _denseIndex(p_event);
+				if (IsFullyDense == true || index < DenseSize)
+					slot = &(_denseProviders[index]);
+			}
+			if (slot == nullptr)
+				slot = _sparseProviders.tryEmplace(p_event).first;
+
+			if (*slot == nullptr)
+				*slot = std::make_unique<ContractProvider>();
+			return (**slot);
+		}
 
 	public:
 		EventNotifier() = default;
 		virtual ~EventNotifier() = default;
 
-		ContractProvider::Contract subscribe(const TType& p_event, const ContractProvider::Job& p_job)
+		template <typename TCallable>
+		Contract subscribe(const TType& p_event, TCallable&& p_job)
 		{
-			return _eventProviders[p_event].subscribe(p_job);
+			return _obtainProvider(p_event).subscribe(std::forward<TCallable>(p_job));
 		}
 
 		void invalidateContracts(const TType& p_event)
 		{
-			_eventProviders[p_event].invalidateContracts();
+			ContractProvider* provider = _provider(p_event);
+			if (provider != nullptr)
+				provider->invalidateContracts();
 		}
 
-		void unsubscribe(const TType& p_event, const ContractProvider::Contract& p_contract)
+		void unsubscribe(const TType& p_event, const Contract& p_contract)
 		{
-			_eventProviders[p_event].unsubscribe(p_contract);
+			ContractProvider* provider = _provider(p_event);
+			if (provider != nullptr)
+				provider->unsubscribe(p_contract);
 		}
 
-		void notifyEvent(const TType& p_event)
+		void notifyEvent(const TType& p_event, spk::ContractParameter<TPayloadTypes>... p_payloads)
 		{
-			auto it = _eventProviders.find(p_event);
-			if (it != _eventProviders.end())
+			ContractProvider* provider = _provider(p_event);
+			if (provider != nullptr)
 			{
-				it->second.trigger();
+				provider->trigger(p_payloads...);
 			}
 		}
 	};
@@ -1,31 +1,63 @@
 #pragma once
 
 #include "structure/design_pattern/spk_contract_provider.hpp"
+#include "structure/design_pattern/spk_deferred_notification_queue.hpp"
+
+#include <concepts>
 
 namespace spk
 {
 	template<typename TType>
-	class ObservableValue
+	class ObservableValue : public spk::DeferredNotificationQueue::INotifiable
 	{
+	public:
+		using ContractProvider = spk::TContractProvider<const TType&>;
+		using Contract = typename ContractProvider::Contract;
+		using Job = typename ContractProvider::Job;
+
+		enum class NotificationMode
+		{
+			Immediate,
+			Deferred
+		};
+
 	private:
-		TType _value;
+		TType _value{};
 		ContractProvider _contractProvider;
+		NotificationMode _notificationMode = NotificationMode::Immediate;
+
+		void _flushNotification() override
+		{
+			_contractProvider.trigger(_value);
+		}
 
 	protected:
 		void notifyEdition()
 		{
-			_contractProvider.trigger();
+			if (_notificationMode == NotificationMode::Deferred)
+				requestNotification();
+			else
+				_contractProvider.trigger(_value);
 		}
 
 	public:
 		ObservableValue() = default;
 
-		ObservableValue(const TType& p_value) :
-			_value(p_value)
+		ObservableValue(const TType& p_value, NotificationMode p_notificationMode = NotificationMode::Immediate) :
+			_value(p_value),
+			_notificationMode(p_notificationMode)
 		{
 
 		}
 
+		ObservableValue(const ObservableValue& p_other) = delete;
+		ObservableValue& operator =(const ObservableValue& p_other) = delete;
+
+		~ObservableValue()
+		{
+			cancelNotification();
+		}
+
 		ObservableValue& operator =(const TType& p_value)
 		{
 			set(p_value);
@@ -44,13 +76,41 @@ namespace spk
 
 		void set(const TType& p_value)
 		{
+			// A deferred notification already carries the latest value, so an unchanged value has nothing to add
+			if constexpr (std::equality_comparable<TType>)
+			{
+				if (_notificationMode == NotificationMode::Deferred && _value == p_value)
+					return;
+			}
+
 			_value = p_value;
 			notifyEdition();
 		}
 
-		ContractProvider::Contract subscribe(const ContractProvider::Job& p_job)
+		void setNotificationMode(NotificationMode p_notificationMode)
+		{
+			if (p_notificationMode == NotificationMode::Immediate && isPending() == true)
+			{
+				cancelNotification();
+				_contractProvider.trigger(_value);
+			}
+			_notificationMode = p_notificationMode;
+		}
+
+		NotificationMode notificationMode() const
+		{
+			return (_notificationMode);
+		}
+
+		bool isDirty() const
+		{
+			return (isPending());
+		}
+
+		template <typename TCallable>
+		Contract subscribe(TCallable&& p_job)
 		{
-			return _contractProvider.subscribe(p_job);
+			return _contractProvider.subscribe(std::forward<TCallable>(p_job));
 		}
 	};
 }
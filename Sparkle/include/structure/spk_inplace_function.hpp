@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace spk
+{
+	template <typename TSignature, size_t Capacity = 48, bool AllowHeap = false>
+	class InplaceFunction;
+
+	template <typename TReturn, typename... TArgs, size_t Capacity, bool AllowHeap>
+	class InplaceFunction<TReturn(TArgs...), Capacity, AllowHeap>
+	{
+		static_assert(Capacity >= sizeof(void*), "InplaceFunction capacity must at least hold a pointer");
+
+	private:
+		enum class Operation
+		{
+			Copy,
+			Move,
+			Destroy
+		};
+
+		using Invoker = TReturn(*)(void*, TArgs...);
+		using Manager = void(*)(Operation, void*, void*);
+
+		template <typename TCallable>
+		static constexpr bool IsStoredInline = sizeof(TCallable) <= Capacity &&
+			alignof(TCallable) <= alignof(std::max_align_t) &&
+			std::is_nothrow_move_constructible_v<TCallable>;
+
+		template <typename TCallable>
+		static TCallable* _callable(void* p_storage)
+		{
+			if constexpr (IsStoredInline<TCallable>)
+				return (std::launder(reinterpret_cast<TCallable*>(p_storage)));
+			else
+				return (*std::launder(reinterpret_cast<TCallable**>(p_storage)));
+		}
+
+		template <typename TCallable>
+		static TReturn _invoke(void* p_storage, TArgs... p_args)
+		{
+			return (std::invoke(*_callable<TCallable>(p_storage), std::forward<TArgs>(p_args)...));
+		}
+
+		template <typename TCallable>
+		static void _manage(Operation p_operation, void* p_source, void* p_destination)
+		{
+			switch (p_operation)
+			{
+			case Operation::Copy:
+				if constexpr (IsStoredInline<TCallable>)
+					new (p_destination) TCallable(*_callable<TCallable>(p_source));
+				else
+					new (p_destination) TCallable*(new TCallable(*_callable<TCallable>(p_source)));
+				break;
+			case Operation::Move:
+				if constexpr (IsStoredInline<TCallable>)
+				{
+					new (p_destination) TCallable(std::move(*_callable<TCallable>(p_source)));
+					_callable<TCallable>(p_source)->~TCallable();
+				}
+				else
+				{
+					new (p_destination) TCallable*(_callable<TCallable>(p_source));
+				}
+				break;
+			case Operation::Destroy:
+				if constexpr (IsStoredInline<TCallable>)
+					_callable<TCallable>(p_source)->~TCallable();
+				else
+					delete _callable<TCallable>(p_source);
+				break;
+			}
+		}
+
+		alignas(std::max_align_t) mutable std::byte _storage[Capacity];
+		Invoker _invoker = nullptr;
+		Manager _manager = nullptr;
+
+		void _copyFrom(const InplaceFunction& p_other)
+		{
+			if (p_other._manager != nullptr)
+			{
+				p_other._manager(Operation::Copy, p_other._storage, _storage);
+				_invoker = p_other._invoker;
+				_manager = p_other._manager;
+			}
+		}
+
+		void _moveFrom(InplaceFunction& p_other) noexcept
+		{
+			if (p_other._manager != nullptr)
+			{
+				p_other._manager(Operation::Move, p_other._storage, _storage);
+				_invoker = std::exchange(p_other._invoker, nullptr);
+				_manager = std::exchange(p_other._manager, nullptr);
+			}
+		}
+
+	public:
+		template <typename TCallable>
+		static constexpr bool fitsInline()
+		{
+			return (IsStoredInline<std::decay_t<TCallable>>);
+		}
+
+		InplaceFunction() = default;
+
+		InplaceFunction(std::nullptr_t)
+		{
+
+		}
+
+		template <typename TCallable, typename = std::enable_if_t<
+			std::is_same_v<std::decay_t<TCallable>, InplaceFunction> == false &&
+			std::is_invocable_r_v<TReturn, std::decay_t<TCallable>&, TArgs...>>>
+		InplaceFunction(TCallable&& p_callable)
+		{
+			using Callable = std::decay_t<TCallable>;
+
+			static_assert(std::is_copy_constructible_v<Callable>, "InplaceFunction requires a copyable callable");
+			static_assert(IsStoredInline<Callable> || AllowHeap, "Callable doesn't fit inside the InplaceFunction capacity");
+
+			if constexpr (std::is_pointer_v<Callable> || std::is_member_pointer_v<Callable> || std::is_same_v<Callable, std::function<TReturn(TArgs...)>>)
+			{
+				if (p_callable == nullptr)
+					return;
+			}
+
+			if constexpr (IsStoredInline<Callable>)
+				new (_storage) Callable(std::forward<TCallable>(p_callable));
+			else
+				new (_storage) Callable*(new Callable(std::forward<TCallable>(p_callable)));
+
+			_invoker = &_invoke<Callable>;
+			_manager = &_manage<Callable>;
+		}
+
+		InplaceFunction(const InplaceFunction& p_other)
+		{
+			_copyFrom(p_other);
+		}
+
+		InplaceFunction(InplaceFunction&& p_other) noexcept
+		{
+			_moveFrom(p_other);
+		}
+
+		~InplaceFunction()
+		{
+			reset();
+		}
+
+		InplaceFunction& operator =(const InplaceFunction& p_other)
+		{
+			if (this != &p_other)
+			{
+				InplaceFunction copy(p_other);
+				reset();
+				_moveFrom(copy);
+			}
+			return (*this);
+		}
+
+		InplaceFunction& operator =(InplaceFunction&& p_other) noexcept
+		{
+			if (this != &p_other)
+			{
+				reset();
+				_moveFrom(p_other);
+			}
+			return (*this);
+		}
+
+		InplaceFunction& operator =(std::nullptr_t)
+		{
+			reset();
+			return (*this);
+		}
+
+		void reset()
+		{
+			if (_manager != nullptr)
+			{
+				_manager(Operation::Destroy, _storage, nullptr);
+				_invoker = nullptr;
+				_manager = nullptr;
+			}
+		}
+
+		TReturn operator()(TArgs... p_args) const
+		{
+			if (_invoker == nullptr)
+				throw std::bad_function_call();
+			return (_invoker(_storage, std::forward<TArgs>(p_args)...));
+		}
+
+		explicit operator bool() const
+		{
+			return (_invoker != nullptr);
+		}
+
+		bool operator ==(std::nullptr_t) const
+		{
+			return (_invoker == nullptr);
+		}
+	};
+}
\ No newline at end of file
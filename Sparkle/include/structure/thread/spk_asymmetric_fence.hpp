@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+
+namespace spk
+{
+	// Pairs a compiler-only fence on a hot path with a process-wide fence on a rare path, so that
+	// "store, light(), load" on one thread and "store, heavy(), load" on another never both miss each other's store
+	class AsymmetricFence
+	{
+	private:
+		static bool _registerHeavyFence();
+
+		static bool _isHeavyFenceSupported()
+		{
+			static const bool result = _registerHeavyFence();
+			return (result);
+		}
+
+	public:
+		static void light()
+		{
+			if (_isHeavyFenceSupported() == true)
+				std::atomic_signal_fence(std::memory_order_seq_cst);
+			else
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+		}
+
+		static void heavy();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace spk
+{
+	class CoroutineFramePool
+	{
+	public:
+		static constexpr size_t MinBlockSize = 64;
+		static constexpr size_t NbSizeClass = 8;
+		static constexpr size_t MaxBlockSize = MinBlockSize << (NbSizeClass - 1);
+		static constexpr size_t MaxCachedBlock = 64;
+		static constexpr size_t TransferBatchSize = MaxCachedBlock / 2;
+		static constexpr size_t MaxSharedBlock = MaxCachedBlock * 16;
+
+	private:
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		struct FreeList
+		{
+			FreeBlock* head = nullptr;
+			size_t size = 0;
+
+			void push(FreeBlock* p_block)
+			{
+				p_block->next = head;
+				head = p_block;
+				size++;
+			}
+
+			FreeBlock* pop()
+			{
+				FreeBlock* result = head;
+				if (result != nullptr)
+				{
+					head = result->next;
+					size--;
+				}
+				return (result);
+			}
+
+			void splice(FreeList& p_other, size_t p_nbBlock)
+			{
+				for (size_t i = 0; i < p_nbBlock && p_other.head != nullptr; i++)
+					push(p_other.pop());
+			}
+
+			void release()
+			{
+				while (head != nullptr)
+					::operator delete(pop());
+			}
+		};
+
+		struct SharedCache
+		{
+			std::mutex mutex;
+			FreeList freeLists[NbSizeClass];
+			// Lets a thread skip the mutex when the shared list it would refill from is empty
+			std::atomic<size_t> nbBlocks[NbSizeClass] = {};
+
+			~SharedCache()
+			{
+				for (FreeList& freeList : freeLists)
+					freeList.release();
+			}
+		};
+
+		struct LocalCache
+		{
+			FreeList freeLists[NbSizeClass];
+
+			~LocalCache()
+			{
+				for (FreeList& freeList : freeLists)
+					freeList.release();
+			}
+		};
+
+		static inline std::atomic<uint64_t> _nbHeapAllocation = 0;
+
+		static SharedCache& _sharedCache()
+		{
+			static SharedCache result;
+			return (result);
+		}
+
+		static LocalCache& _localCache()
+		{
+			static thread_local LocalCache result;
+			return (result);
+		}
+
+		static size_t _sizeClass(size_t p_size)
+		{
+			size_t result = 0;
+			for (size_t blockSize = MinBlockSize; blockSize < p_size; blockSize *= 2)
+				result++;
+			return (result);
+		}
+
+	public:
+		static void* allocate(size_t p_size)
+		{
+			if (p_size > MaxBlockSize)
+			{
+				_nbHeapAllocation.fetch_add(1, std::memory_order_relaxed);
+				return (::operator new(p_size));
+			}
+
+			size_t sizeClass = _sizeClass(p_size);
+			FreeList& freeList = _localCache().freeLists[sizeClass];
+
+			SharedCache& sharedCache = _sharedCache();
+			if (freeList.head == nullptr && sharedCache.nbBlocks[sizeClass].load(std::memory_order_relaxed) != 0)
+			{
+				std::lock_guard<std::mutex> lock(sharedCache.mutex);
+				freeList.splice(sharedCache.freeLists[sizeClass], TransferBatchSize);
+				sharedCache.nbBlocks[sizeClass].store(sharedCache.freeLists[sizeClass].size, std::memory_order_relaxed);
+			}
+
+			FreeBlock* result = freeList.pop();
+			if (result != nullptr)
+				return (result);
+
+			_nbHeapAllocation.fetch_add(1, std::memory_order_relaxed);
+			return (::operator new(MinBlockSize << sizeClass));
+		}
+
+		static void deallocate(void* p_pointer, size_t p_size)
+		{
+			if (p_size > MaxBlockSize)
+			{
+				::operator delete(p_pointer);
+				return;
+			}
+
+			size_t sizeClass = _sizeClass(p_size);
+			FreeList& freeList = _localCache().freeLists[sizeClass];
+
+			if (freeList.size >= MaxCachedBlock)
+			{
+				SharedCache& sharedCache = _sharedCache();
+				FreeList overflow;
+				{
+					std::lock_guard<std::mutex> lock(sharedCache.mutex);
+					FreeList& sharedList = sharedCache.freeLists[sizeClass];
+					sharedList.splice(freeList, std::min(TransferBatchSize, MaxSharedBlock - std::min(sharedList.size, MaxSharedBlock)));
+					sharedCache.nbBlocks[sizeClass].store(sharedList.size, std::memory_order_relaxed);
+				}
+				// The shared list is full: give the rest of the batch back to the heap
+				overflow.splice(freeList, freeList.size - std::min(freeList.size, MaxCachedBlock - TransferBatchSize));
+				overflow.release();
+			}
+
+			freeList.push(static_cast<FreeBlock*>(p_pointer));
+		}
+
+		static uint64_t nbHeapAllocation()
+		{
+			return (_nbHeapAllocation.load(std::memory_order_relaxed));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,395 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "structure/spk_inplace_function.hpp"
+#include "structure/thread/spk_coroutine_frame_pool.hpp"
+
+namespace spk
+{
+	template <typename TType>
+	class Future;
+
+	template <typename TType>
+	class Promise;
+
+	class IFutureState
+	{
+	public:
+		using Job = spk::InplaceFunction<void(), 64, true>;
+
+	private:
+		static constexpr uint32_t ClaimedFlag = 1 << 0;
+		static constexpr uint32_t ReadyFlag = 1 << 1;
+		static constexpr uint32_t ContinuationFlag = 1 << 2;
+		static constexpr uint32_t WaitedFlag = 1 << 3;
+
+		std::atomic<uint32_t> _nbReference = 0;
+		std::atomic<uint32_t> _nbPromise = 0;
+		mutable std::atomic<uint32_t> _flags = 0;
+		std::exception_ptr _exception;
+		Job _continuation;
+
+		void _runContinuation()
+		{
+			Job continuation = std::move(_continuation);
+			continuation();
+		}
+
+	protected:
+		void _claim()
+		{
+			if ((_flags.fetch_or(ClaimedFlag, std::memory_order_acq_rel) & ClaimedFlag) != 0)
+				throw std::runtime_error("Unable to fulfill a future twice.");
+		}
+
+		void _publish()
+		{
+			uint32_t previousFlags = _flags.fetch_or(ReadyFlag, std::memory_order_acq_rel);
+
+			if ((previousFlags & WaitedFlag) != 0)
+				_flags.notify_all();
+			if ((previousFlags & ContinuationFlag) != 0)
+				_runContinuation();
+		}
+
+		void _rethrowException() const
+		{
+			if (_exception != nullptr)
+				std::rethrow_exception(_exception);
+		}
+
+	public:
+		virtual ~IFutureState() = default;
+
+		static void* operator new(size_t p_size)
+		{
+			return (spk::CoroutineFramePool::allocate(p_size));
+		}
+
+		static void operator delete(void* p_pointer, size_t p_size)
+		{
+			spk::CoroutineFramePool::deallocate(p_pointer, p_size);
+		}
+
+		void acquire()
+		{
+			_nbReference.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void release()
+		{
+			if (_nbReference.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				delete this;
+		}
+
+		void acquirePromise()
+		{
+			_nbPromise.fetch_add(1, std::memory_order_relaxed);
+			acquire();
+		}
+
+		void releasePromise()
+		{
+			if (_nbPromise.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+				(_flags.fetch_or(ClaimedFlag, std::memory_order_acq_rel) & ClaimedFlag) == 0)
+			{
+				_exception = std::make_exception_ptr(std::runtime_error("Unable to obtain the result of a future, its promise was abandoned."));
+				_publish();
+			}
+			release();
+		}
+
+		bool isReady() const
+		{
+			return ((_flags.load(std::memory_order_acquire) & ReadyFlag) != 0);
+		}
+
+		void wait() const
+		{
+			uint32_t flags = _flags.fetch_or(WaitedFlag, std::memory_order_acq_rel) | WaitedFlag;
+			while ((flags & ReadyFlag) == 0)
+			{
+				_flags.wait(flags, std::memory_order_acquire);
+				flags = _flags.load(std::memory_order_acquire);
+			}
+		}
+
+		void setException(std::exception_ptr p_exception)
+		{
+			_claim();
+			_exception = p_exception;
+			_publish();
+		}
+
+		// The continuation runs on the thread fulfilling the future, or immediately if it is already ready
+		void setContinuation(Job&& p_continuation)
+		{
+			if ((_flags.load(std::memory_order_acquire) & ContinuationFlag) != 0)
+				throw std::runtime_error("Unable to chain a second continuation on the same future.");
+
+			_continuation = std::move(p_continuation);
+			if ((_flags.fetch_or(ContinuationFlag, std::memory_order_acq_rel) & ReadyFlag) != 0)
+				_runContinuation();
+		}
+	};
+
+	template <typename TType>
+	class FutureState : public IFutureState
+	{
+	private:
+		std::optional<TType> _value;
+
+	public:
+		template <typename TValue>
+		void setValue(TValue&& p_value)
+		{
+			_claim();
+			_value.emplace(std::forward<TValue>(p_value));
+			_publish();
+		}
+
+		TType& value()
+		{
+			_rethrowException();
+			return (*_value);
+		}
+	};
+
+	template <>
+	class FutureState<void> : public IFutureState
+	{
+	public:
+		void setValue()
+		{
+			_claim();
+			_publish();
+		}
+
+		void value()
+		{
+			_rethrowException();
+		}
+	};
+
+	template <typename TType, typename TFunctor>
+	struct FutureContinuationResult
+	{
+		using Type = std::invoke_result_t<TFunctor&, TType&>;
+	};
+
+	template <typename TFunctor>
+	struct FutureContinuationResult<void, TFunctor>
+	{
+		using Type = std::invoke_result_t<TFunctor&>;
+	};
+
+	template <typename TType>
+	class Promise
+	{
+	private:
+		FutureState<TType>* _state;
+
+	public:
+		Promise() :
+			_state(new FutureState<TType>())
+		{
+			_state->acquirePromise();
+		}
+
+		Promise(const Promise& p_other) :
+			_state(p_other._state)
+		{
+			if (_state != nullptr)
+				_state->acquirePromise();
+		}
+
+		Promise(Promise&& p_other) noexcept :
+			_state(std::exchange(p_other._state, nullptr))
+		{
+
+		}
+
+		Promise& operator=(const Promise& p_other)
+		{
+			Promise copy(p_other);
+			std::swap(_state, copy._state);
+			return (*this);
+		}
+
+		Promise& operator=(Promise&& p_other) noexcept
+		{
+			std::swap(_state, p_other._state);
+			return (*this);
+		}
+
+		~Promise()
+		{
+			if (_state != nullptr)
+				_state->releasePromise();
+		}
+
+		Future<TType> future() const
+		{
+			return (Future<TType>(_state));
+		}
+
+		template <typename... TValue>
+		void setValue(TValue&&... p_value)
+		{
+			_state->setValue(std::forward<TValue>(p_value)...);
+		}
+
+		void setException(std::exception_ptr p_exception)
+		{
+			_state->setException(p_exception);
+		}
+
+		template <typename TFunctor>
+		void setResultOf(TFunctor&& p_functor)
+		{
+			try
+			{
+				if constexpr (std::is_void_v<TType>)
+				{
+					p_functor();
+					setValue();
+				}
+				else
+				{
+					setValue(p_functor());
+				}
+			}
+			catch (...)
+			{
+				setException(std::current_exception());
+			}
+		}
+	};
+
+	template <typename TType>
+	class Future
+	{
+		friend class Promise<TType>;
+
+	public:
+		using Job = IFutureState::Job;
+
+	private:
+		FutureState<TType>* _state = nullptr;
+
+		explicit Future(FutureState<TType>* p_state) :
+			_state(p_state)
+		{
+			if (_state != nullptr)
+				_state->acquire();
+		}
+
+		template <typename TFunctor>
+		auto _continuation(TFunctor&& p_functor) const
+		{
+			using TResult = typename FutureContinuationResult<TType, std::decay_t<TFunctor>>::Type;
+
+			if (_state == nullptr)
+				throw std::runtime_error("Unable to chain a continuation on an empty future.");
+
+			Promise<TResult> promise;
+			return (std::make_pair(promise.future(), [source = *this, promise, functor = std::decay_t<TFunctor>(std::forward<TFunctor>(p_functor))]() mutable {
+					promise.setResultOf([&]() -> TResult {
+							if constexpr (std::is_void_v<TType>)
+							{
+								source._state->value();
+								return (functor());
+							}
+							else
+							{
+								return (functor(source._state->value()));
+							}
+						});
+				}));
+		}
+
+	public:
+		Future() = default;
+
+		Future(const Future& p_other) :
+			Future(p_other._state)
+		{
+
+		}
+
+		Future(Future&& p_other) noexcept :
+			_state(std::exchange(p_other._state, nullptr))
+		{
+
+		}
+
+		Future& operator=(const Future& p_other)
+		{
+			Future copy(p_other);
+			std::swap(_state, copy._state);
+			return (*this);
+		}
+
+		Future& operator=(Future&& p_other) noexcept
+		{
+			std::swap(_state, p_other._state);
+			return (*this);
+		}
+
+		~Future()
+		{
+			if (_state != nullptr)
+				_state->release();
+		}
+
+		bool isValid() const
+		{
+			return (_state != nullptr);
+		}
+
+		bool ready() const
+		{
+			return (_state != nullptr && _state->isReady());
+		}
+
+		// Blocks the calling thread: never wait on the worker that has to fulfill this future.
+		void wait() const
+		{
+			if (_state == nullptr)
+				throw std::runtime_error("Unable to wait an empty future.");
+			_state->wait();
+		}
+
+		std::add_lvalue_reference_t<TType> get() const
+		{
+			wait();
+			return (_state->value());
+		}
+
+		template <typename TFunctor>
+		Future<typename FutureContinuationResult<TType, std::decay_t<TFunctor>>::Type> then(TFunctor&& p_functor) const
+		{
+			auto [result, continuation] = _continuation(std::forward<TFunctor>(p_functor));
+			_state->setContinuation(std::move(continuation));
+			return (result);
+		}
+
+		// Runs the continuation through p_executor.schedule(), for example to come back on the worker that asked for the result
+		template <typename TExecutor, typename TFunctor>
+		Future<typename FutureContinuationResult<TType, std::decay_t<TFunctor>>::Type> then(TExecutor& p_executor, TFunctor&& p_functor) const
+		{
+			auto [result, continuation] = _continuation(std::forward<TFunctor>(p_functor));
+			_state->setContinuation([executor = &p_executor, continuation]() {
+					executor->schedule(continuation);
+				});
+			return (result);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "structure/spk_inplace_function.hpp"
+#include "structure/container/spk_work_stealing_deque.hpp"
+#include "structure/thread/spk_thread.hpp"
+
+namespace spk
+{
+	class JobSystem
+	{
+	public:
+		static constexpr size_t JobCapacity = 64;
+
+		using Job = spk::InplaceFunction<void(), JobCapacity, true>;
+
+	private:
+		static constexpr size_t CacheLineSize = 64;
+		static constexpr size_t NbSpinBeforeSleep = 64;
+		static constexpr size_t NoWorker = SIZE_MAX;
+
+		struct Task
+		{
+			static constexpr uint32_t NoCallback = 0;
+			static constexpr uint32_t CallbackRegistered = 1;
+			static constexpr uint32_t Completed = 2;
+
+			Job job;
+			Job completionCallback;
+			JobSystem* system = nullptr;
+			Task* parent = nullptr;
+			std::atomic<uint32_t> nbPending = 1;
+			std::atomic<uint32_t> nbReference = 1;
+			std::atomic<uint32_t> completionState = NoCallback;
+		};
+
+		struct alignas(CacheLineSize) Worker
+		{
+			spk::WorkStealingDeque<Task*> tasks;
+			std::unique_ptr<spk::Thread> thread;
+		};
+
+	public:
+		class Handle
+		{
+			friend class JobSystem;
+
+		private:
+			Task* _task = nullptr;
+
+			explicit Handle(Task* p_task);
+
+		public:
+			Handle() = default;
+			Handle(const Handle& p_other);
+			Handle(Handle&& p_other) noexcept;
+			Handle& operator=(const Handle& p_other);
+			Handle& operator=(Handle&& p_other) noexcept;
+			~Handle();
+
+			bool isValid() const;
+			bool isDone() const;
+
+			// Runs on the thread completing the job, or immediately if it is already done
+			void onCompletion(Job&& p_callback) const;
+		};
+
+	private:
+		static inline thread_local JobSystem* _currentSystem = nullptr;
+		static inline thread_local size_t _currentWorkerIndex = NoWorker;
+		static inline thread_local Task* _currentTask = nullptr;
+
+		std::vector<std::unique_ptr<Worker>> _workers;
+		std::atomic<bool> _isRunning = false;
+
+		alignas(CacheLineSize) std::atomic<uint32_t> _workEpoch = 0;
+		std::atomic<size_t> _nbSleepingWorker = 0;
+
+		alignas(CacheLineSize) std::mutex _injectionMutex;
+		std::deque<Task*> _injectedTasks;
+		std::atomic<size_t> _nbInjectedTask = 0;
+
+		static void _release(Task* p_task);
+
+		void _workerLoop(size_t p_index);
+		void _notifyWorkers();
+		void _schedule(Task* p_task);
+		Task* _findTask();
+		void _execute(Task* p_task);
+		void _finish(Task* p_task);
+
+		template <typename TFunctor>
+		void _splitRange(size_t p_begin, size_t p_end, size_t p_grainSize, TFunctor* p_functor)
+		{
+			while (p_end - p_begin > p_grainSize)
+			{
+				size_t middle = p_begin + (p_end - p_begin) / 2;
+				submit([this, middle, p_end, p_grainSize, p_functor]() {
+						_splitRange(middle, p_end, p_grainSize, p_functor);
+					});
+				p_end = middle;
+			}
+
+			for (size_t i = p_begin; i < p_end; i++)
+				(*p_functor)(i);
+		}
+
+	public:
+		static size_t defaultNbWorker();
+
+		JobSystem(size_t p_nbWorker = defaultNbWorker(), const spk::ThreadPlacement& p_placement = spk::ThreadPlacement());
+		~JobSystem();
+
+		JobSystem(const JobSystem& p_other) = delete;
+		JobSystem& operator=(const JobSystem& p_other) = delete;
+
+		static JobSystem* current();
+
+		size_t nbWorker() const;
+
+		Handle submit(Job&& p_job);
+
+		template <typename TCallable>
+		Handle submit(TCallable&& p_job)
+		{
+			return (submit(Job(std::forward<TCallable>(p_job))));
+		}
+
+		void wait(const Handle& p_handle);
+
+		template <typename TFunctor>
+		void parallelFor(size_t p_begin, size_t p_end, TFunctor&& p_functor, size_t p_grainSize = 0)
+		{
+			if (p_begin >= p_end)
+				return;
+
+			if (p_grainSize == 0)
+				p_grainSize = std::max<size_t>(1, (p_end - p_begin) / ((_workers.size() + 1) * 8));
+
+			std::remove_reference_t<TFunctor>* functor = &p_functor;
+			wait(submit([this, p_begin, p_end, p_grainSize, functor]() {
+					_splitRange(p_begin, p_end, p_grainSize, functor);
+				}));
+		}
+	};
+}
\ No newline at end of file
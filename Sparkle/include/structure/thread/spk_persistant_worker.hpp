@@ -3,36 +3,253 @@
 #include "structure/thread/spk_thread.hpp"
 
 #include "structure/design_pattern/spk_contract_provider.hpp"
+#include "structure/design_pattern/spk_deferred_notification_queue.hpp"
+#include "structure/container/spk_frame_arena.hpp"
+#include "structure/container/spk_mpsc_queue.hpp"
+#include "structure/thread/spk_future.hpp"
+#include "structure/thread/spk_timed_step.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace spk
 {
+	class Application;
+
 	class PersistantWorker : public spk::Thread
 	{
+		friend class Application;
+
 	public:
 		using Job = spk::ContractProvider::Job;
 		using Contract = spk::ContractProvider::Contract;
 
+		enum class RunPolicy
+		{
+			Spin,
+			Backoff,
+			FixedRate,
+			WakeOnWork
+		};
+
+		struct Statistics
+		{
+			uint64_t nbIteration = 0;
+			std::chrono::nanoseconds busyTime = std::chrono::nanoseconds(0);
+			std::chrono::nanoseconds idleTime = std::chrono::nanoseconds(0);
+
+			double utilization() const
+			{
+				std::chrono::nanoseconds totalTime = busyTime + idleTime;
+				if (totalTime.count() == 0)
+					return (0);
+				return (static_cast<double>(busyTime.count()) / static_cast<double>(totalTime.count()));
+			}
+		};
+
+		static constexpr std::chrono::nanoseconds DefaultTickDuration = std::chrono::nanoseconds(16'666'667);
+		static constexpr std::chrono::nanoseconds DefaultSpinTail = std::chrono::microseconds(500);
+
 	private:
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr size_t NbBackoffYield = 16;
+		static constexpr size_t MaxBackoffLevel = NbBackoffYield + 5;
+		static constexpr std::chrono::microseconds MinBackoffSleep = std::chrono::microseconds(50);
+
 		std::atomic<bool> _running;
 
+		std::atomic<RunPolicy> _runPolicy = RunPolicy::Spin;
+		std::atomic<int64_t> _tickDuration = DefaultTickDuration.count();
+		std::atomic<int64_t> _spinTail = DefaultSpinTail.count();
+		std::atomic<uint32_t> _wakeCounter = 0;
+		uint32_t _observedWakeCounter = 0;
+		size_t _backoffLevel = 0;
+		Clock::time_point _nextTick;
+
+		std::atomic<uint64_t> _nbIteration = 0;
+		std::atomic<int64_t> _busyTime = 0;
+		std::atomic<int64_t> _idleTime = 0;
+
 		spk::ContractProvider _preparationJobs;
 		spk::ContractProvider _executionJobs;
 
+		spk::MPSCQueue<Job> _scheduledJobs;
+		std::vector<Job> _pendingJobs;
+
+		spk::FrameArena _frameArena;
+
+		mutable std::mutex _timedStepMutex;
+		std::vector<std::weak_ptr<spk::TimedStep>> _timedSteps;
+
+		static inline thread_local PersistantWorker* _currentWorker = nullptr;
+
+		void _bindToCurrentThread()
+		{
+			_currentWorker = this;
+		}
+
+		static void _unbindCurrentThread()
+		{
+			_currentWorker = nullptr;
+		}
+
+		void _executeIteration()
+		{
+			Clock::time_point start = Clock::now();
+
+			_frameArena.reset();
+			_executeScheduledJobs();
+			_executionJobs.trigger();
+			spk::DeferredNotificationQueue::local().flush();
+
+			_busyTime.fetch_add((Clock::now() - start).count(), std::memory_order_relaxed);
+			_nbIteration.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void _executeScheduledJobs()
+		{
+			// Runs from a local vector, so a throwing job never leaves already executed jobs behind to run again
+			std::vector<Job> jobs;
+			jobs.swap(_pendingJobs);
+			_scheduledJobs.drain([&](Job&& p_job) { jobs.push_back(std::move(p_job)); });
+
+			for (Job& job : jobs)
+				job();
+			jobs.clear();
+			_pendingJobs.swap(jobs);
+		}
+
+		Contract _addTimedStep(const std::shared_ptr<spk::TimedStep>& p_timedStep)
+		{
+			{
+				std::lock_guard<std::mutex> lock(_timedStepMutex);
+				std::erase_if(_timedSteps, [](const std::weak_ptr<spk::TimedStep>& p_step) { return (p_step.expired()); });
+				_timedSteps.push_back(p_timedStep);
+			}
+			return (_executionJobs.subscribe([p_timedStep]() { p_timedStep->execute(); }));
+		}
+
+		void _resetSchedule()
+		{
+			_nextTick = Clock::now();
+			_backoffLevel = 0;
+		}
+
+		bool _consumeWakeUp()
+		{
+			uint32_t wakeCounter = _wakeCounter.load(std::memory_order_acquire);
+			if (wakeCounter == _observedWakeCounter)
+				return (false);
+			_observedWakeCounter = wakeCounter;
+			return (true);
+		}
+
+		void _backoff()
+		{
+			if (_consumeWakeUp() == true)
+			{
+				_backoffLevel = 0;
+				return;
+			}
+
+			if (_backoffLevel < NbBackoffYield)
+				std::this_thread::yield();
+			else
+				std::this_thread::sleep_for(MinBackoffSleep * (1 << (_backoffLevel - NbBackoffYield)));
+
+			_backoffLevel = std::min(_backoffLevel + 1, MaxBackoffLevel);
+		}
+
+		void _waitNextTick()
+		{
+			Clock::time_point now = Clock::now();
+			std::chrono::nanoseconds tickDuration(_tickDuration.load(std::memory_order_relaxed));
+			std::chrono::nanoseconds spinTail(_spinTail.load(std::memory_order_relaxed));
+
+			_nextTick += tickDuration;
+			if (_nextTick < now - tickDuration)
+				_nextTick = now;
+
+			if (_nextTick - now > spinTail)
+				std::this_thread::sleep_until(_nextTick - spinTail);
+			while (Clock::now() < _nextTick)
+				std::this_thread::yield();
+		}
+
+		void _waitForWork()
+		{
+			if (_consumeWakeUp() == true)
+				return;
+
+			_wakeCounter.wait(_observedWakeCounter, std::memory_order_acquire);
+			_consumeWakeUp();
+		}
+
+		void _waitNextIteration()
+		{
+			RunPolicy runPolicy = _runPolicy.load(std::memory_order_relaxed);
+			if (runPolicy == RunPolicy::Spin)
+				return;
+
+			Clock::time_point start = Clock::now();
+
+			switch (runPolicy)
+			{
+			case RunPolicy::Backoff:
+				_backoff();
+				break;
+			case RunPolicy::FixedRate:
+				_waitNextTick();
+				break;
+			case RunPolicy::WakeOnWork:
+				_waitForWork();
+				break;
+			default:
+				break;
+			}
+
+			_idleTime.fetch_add((Clock::now() - start).count(), std::memory_order_relaxed);
+		}
+
 	public:
-		PersistantWorker(const std::wstring& p_name) :
+		PersistantWorker(const std::wstring& p_name, const spk::ThreadPlacement& p_placement = spk::ThreadPlacement()) :
 			spk::Thread(p_name, [&]()
 				{
-					this->_running = true;
+					_bindToCurrentThread();
 					_preparationJobs.trigger();
+					_resetSchedule();
 					while (this->_running.load() == true)
 					{
-						_executionJobs.trigger();
+						_executeIteration();
+						if (this->_running.load() == true)
+							_waitNextIteration();
 					}
-				})
+					_unbindCurrentThread();
+				}, p_placement)
 		{
 
 		}
 
+		static PersistantWorker* current()
+		{
+			return (_currentWorker);
+		}
+
+		static spk::FrameArena* currentFrameArena()
+		{
+			if (_currentWorker == nullptr)
+				return (nullptr);
+			return (&(_currentWorker->_frameArena));
+		}
+
 		~PersistantWorker()
 		{
 			if (this->_running.load() == true)
@@ -41,12 +258,102 @@ namespace spk
 				join();
 		}
 
+		void start() override
+		{
+			if (isJoinable() == true)
+				join();
+			this->_running = true;
+			Thread::start();
+		}
+
 		void stop()
 		{
 			this->_running = false;
+			wakeUp();
+		}
+
+		void wakeUp()
+		{
+			_wakeCounter.fetch_add(1, std::memory_order_release);
+			_wakeCounter.notify_one();
+		}
+
+		void schedule(Job&& p_job)
+		{
+			_scheduledJobs.push(std::move(p_job));
+			wakeUp();
+		}
+
+		template <typename TCallable>
+		void schedule(TCallable&& p_job)
+		{
+			schedule(Job(std::forward<TCallable>(p_job)));
+		}
+
+		template <typename TCallable>
+		spk::Future<std::invoke_result_t<std::decay_t<TCallable>&>> post(TCallable&& p_job)
+		{
+			using TResult = std::invoke_result_t<std::decay_t<TCallable>&>;
+
+			spk::Promise<TResult> promise;
+			spk::Future<TResult> result = promise.future();
+			schedule([promise, job = std::decay_t<TCallable>(std::forward<TCallable>(p_job))]() mutable {
+					promise.setResultOf(job);
+				});
+			return (result);
+		}
+
+		void setRunPolicy(RunPolicy p_runPolicy)
+		{
+			_runPolicy.store(p_runPolicy, std::memory_order_relaxed);
+			wakeUp();
 		}
 
-		void join()
+		RunPolicy runPolicy() const
+		{
+			return (_runPolicy.load(std::memory_order_relaxed));
+		}
+
+		void setTickRate(double p_tickPerSecond)
+		{
+			if (p_tickPerSecond <= 0)
+				throw std::runtime_error("Unable to set a tick rate lower or equal to zero.");
+			setTickDuration(std::chrono::nanoseconds(static_cast<int64_t>(1'000'000'000.0 / p_tickPerSecond)));
+		}
+
+		void setTickDuration(std::chrono::nanoseconds p_tickDuration)
+		{
+			_tickDuration.store(p_tickDuration.count(), std::memory_order_relaxed);
+		}
+
+		std::chrono::nanoseconds tickDuration() const
+		{
+			return (std::chrono::nanoseconds(_tickDuration.load(std::memory_order_relaxed)));
+		}
+
+		void setSpinTail(std::chrono::nanoseconds p_spinTail)
+		{
+			_spinTail.store(p_spinTail.count(), std::memory_order_relaxed);
+		}
+
+		Statistics statistics() const
+		{
+			Statistics result;
+
+			result.nbIteration = _nbIteration.load(std::memory_order_relaxed);
+			result.busyTime = std::chrono::nanoseconds(_busyTime.load(std::memory_order_relaxed));
+			result.idleTime = std::chrono::nanoseconds(_idleTime.load(std::memory_order_relaxed));
+			return (result);
+		}
+
+		void resetStatistics()
+		{
+			_nbIteration.store(0, std::memory_order_relaxed);
+			_busyTime.store(0, std::memory_order_relaxed);
+			_idleTime.store(0, std::memory_order_relaxed);
+		}
+
+		void join() override
 		{
 			if (this->_running.load() == true)
 				stop();
@@ -63,6 +370,47 @@ namespace spk
 			return (_executionJobs.subscribe(p_job));
 		}
 
+		Contract addBudgetedStep(const std::wstring& p_name, std::chrono::nanoseconds p_budget, const Job& p_job)
+		{
+			return (_addTimedStep(std::make_shared<spk::TimedStep>(p_name, p_job, p_budget)));
+		}
+
+		Contract addFixedStep(const std::wstring& p_name, std::chrono::nanoseconds p_timestep, const Job& p_job,
+			std::chrono::nanoseconds p_budget = std::chrono::nanoseconds(0), size_t p_maxCatchUpStep = spk::TimedStep::DefaultMaxCatchUpStep)
+		{
+			if (p_timestep.count() <= 0)
+				throw std::runtime_error("Unable to add a fixed step with a timestep lower or equal to zero.");
+			return (_addTimedStep(std::make_shared<spk::TimedStep>(p_name, p_job, p_budget, p_timestep, p_maxCatchUpStep)));
+		}
+
+		// Lets another step read the interpolation of a fixed step, e.g. to blend rendering between two updates
+		std::shared_ptr<const spk::TimedStep> timedStep(const std::wstring& p_name) const
+		{
+			std::lock_guard<std::mutex> lock(_timedStepMutex);
+
+			for (const std::weak_ptr<spk::TimedStep>& step : _timedSteps)
+			{
+				std::shared_ptr<spk::TimedStep> lockedStep = step.lock();
+				if (lockedStep != nullptr && lockedStep->name() == p_name)
+					return (lockedStep);
+			}
+			throw std::runtime_error("Unable to find a timed step with the requested name.");
+		}
+
+		std::vector<spk::TimedStep::Statistics> stepStatistics() const
+		{
+			std::vector<spk::TimedStep::Statistics> result;
+			std::lock_guard<std::mutex> lock(_timedStepMutex);
+
+			for (const std::weak_ptr<spk::TimedStep>& step : _timedSteps)
+			{
+				std::shared_ptr<spk::TimedStep> lockedStep = step.lock();
+				if (lockedStep != nullptr)
+					result.push_back(lockedStep->statistics());
+			}
+			return (result);
+		}
+
 		spk::ContractProvider& preparationJobs()
 		{
 			return (_preparationJobs);
@@ -72,5 +420,10 @@ namespace spk
 		{
 			return (_executionJobs);
 		}
+
+		spk::FrameArena& frameArena()
+		{
+			return (_frameArena);
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,391 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "structure/spk_safe_pointer.hpp"
+#include "structure/thread/spk_coroutine_frame_pool.hpp"
+#include "structure/thread/spk_job_system.hpp"
+#include "structure/thread/spk_persistant_worker.hpp"
+
+namespace spk
+{
+	class ITaskPromise
+	{
+	private:
+		std::atomic<uint32_t> _nbReference = 2;
+		std::atomic<void*> _continuation = nullptr;
+		mutable std::atomic<bool> _isWaited = false;
+
+		static void* _completedMarker()
+		{
+			static int marker;
+			return (&marker);
+		}
+
+	protected:
+		std::exception_ptr _exception;
+
+		void _rethrowException() const
+		{
+			if (_exception != nullptr)
+				std::rethrow_exception(_exception);
+		}
+
+	public:
+		struct FinalAwaiter
+		{
+			bool await_ready() const noexcept
+			{
+				return (false);
+			}
+
+			template <typename TPromise>
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> p_handle) noexcept
+			{
+				ITaskPromise& promise = p_handle.promise();
+				void* continuation = promise._continuation.exchange(_completedMarker(), std::memory_order_seq_cst);
+				if (promise._isWaited.load(std::memory_order_seq_cst) == true)
+					promise._continuation.notify_all();
+				promise.release(p_handle);
+
+				if (continuation == nullptr)
+					return (std::noop_coroutine());
+				return (std::coroutine_handle<>::from_address(continuation));
+			}
+
+			void await_resume() const noexcept
+			{
+
+			}
+		};
+
+		static void* operator new(size_t p_size)
+		{
+			return (spk::CoroutineFramePool::allocate(p_size));
+		}
+
+		static void operator delete(void* p_pointer, size_t p_size)
+		{
+			spk::CoroutineFramePool::deallocate(p_pointer, p_size);
+		}
+
+		std::suspend_never initial_suspend() const noexcept
+		{
+			return {};
+		}
+
+		FinalAwaiter final_suspend() const noexcept
+		{
+			return {};
+		}
+
+		void unhandled_exception()
+		{
+			_exception = std::current_exception();
+		}
+
+		bool isDone() const
+		{
+			return (_continuation.load(std::memory_order_acquire) == _completedMarker());
+		}
+
+		void wait() const
+		{
+			_isWaited.store(true, std::memory_order_seq_cst);
+
+			void* continuation = _continuation.load(std::memory_order_seq_cst);
+			while (continuation != _completedMarker())
+			{
+				_continuation.wait(continuation, std::memory_order_acquire);
+				continuation = _continuation.load(std::memory_order_acquire);
+			}
+		}
+
+		bool setContinuation(std::coroutine_handle<> p_continuation)
+		{
+			void* expected = nullptr;
+			if (_continuation.compare_exchange_strong(expected, p_continuation.address(), std::memory_order_acq_rel, std::memory_order_acquire) == true)
+				return (true);
+			if (expected != _completedMarker())
+				throw std::runtime_error("Unable to await a task already awaited by another coroutine.");
+			return (false);
+		}
+
+		void release(std::coroutine_handle<> p_handle)
+		{
+			if (_nbReference.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				p_handle.destroy();
+		}
+	};
+
+	template <typename TType>
+	class TaskPromise : public ITaskPromise
+	{
+	private:
+		std::optional<TType> _value;
+
+	public:
+		template <typename TValue>
+		void return_value(TValue&& p_value)
+		{
+			_value.emplace(std::forward<TValue>(p_value));
+		}
+
+		TType& value()
+		{
+			_rethrowException();
+			return (*_value);
+		}
+	};
+
+	template <>
+	class TaskPromise<void> : public ITaskPromise
+	{
+	public:
+		void return_void()
+		{
+
+		}
+
+		void value()
+		{
+			_rethrowException();
+		}
+	};
+
+	template <typename TType = void>
+	class Task
+	{
+	public:
+		class promise_type : public TaskPromise<TType>
+		{
+		public:
+			Task get_return_object()
+			{
+				return (Task(std::coroutine_handle<promise_type>::from_promise(*this)));
+			}
+		};
+
+	private:
+		std::coroutine_handle<promise_type> _handle;
+
+		explicit Task(std::coroutine_handle<promise_type> p_handle) :
+			_handle(p_handle)
+		{
+
+		}
+
+	public:
+		class Awaiter
+		{
+		private:
+			std::coroutine_handle<promise_type> _handle;
+
+		public:
+			Awaiter(std::coroutine_handle<promise_type> p_handle) :
+				_handle(p_handle)
+			{
+
+			}
+
+			bool await_ready() const
+			{
+				return (_handle.promise().isDone());
+			}
+
+			bool await_suspend(std::coroutine_handle<> p_continuation)
+			{
+				return (_handle.promise().setContinuation(p_continuation));
+			}
+
+			TType await_resume()
+			{
+				if constexpr (std::is_void_v<TType>)
+					_handle.promise().value();
+				else
+					return (std::move(_handle.promise().value()));
+			}
+		};
+
+		Task() = default;
+
+		Task(Task&& p_other) noexcept :
+			_handle(std::exchange(p_other._handle, nullptr))
+		{
+
+		}
+
+		Task& operator=(Task&& p_other) noexcept
+		{
+			if (this != &p_other)
+			{
+				if (_handle != nullptr)
+					_handle.promise().release(_handle);
+				_handle = std::exchange(p_other._handle, nullptr);
+			}
+			return (*this);
+		}
+
+		Task(const Task& p_other) = delete;
+		Task& operator=(const Task& p_other) = delete;
+
+		~Task()
+		{
+			if (_handle != nullptr)
+				_handle.promise().release(_handle);
+		}
+
+		bool isValid() const
+		{
+			return (_handle != nullptr);
+		}
+
+		bool isDone() const
+		{
+			return (_handle != nullptr && _handle.promise().isDone());
+		}
+
+		// Blocks until the coroutine finishes, so it must not be called from the worker the coroutine resumes on.
+		void wait() const
+		{
+			if (_handle == nullptr)
+				throw std::runtime_error("Unable to wait an empty task.");
+			_handle.promise().wait();
+		}
+
+		std::add_lvalue_reference_t<TType> result()
+		{
+			if (isDone() == false)
+				throw std::runtime_error("Unable to access the result of an unfinished task.");
+			return (_handle.promise().value());
+		}
+
+		Awaiter operator co_await() const
+		{
+			if (_handle == nullptr)
+				throw std::runtime_error("Unable to await an empty task.");
+			return (Awaiter(_handle));
+		}
+	};
+
+	class WorkerAwaiter
+	{
+	private:
+		spk::PersistantWorker* _worker;
+
+	public:
+		WorkerAwaiter(spk::PersistantWorker* p_worker) :
+			_worker(p_worker)
+		{
+			if (_worker == nullptr)
+				throw std::runtime_error("Unable to resume a task on a null worker.");
+		}
+
+		bool await_ready() const
+		{
+			return (spk::PersistantWorker::current() == _worker);
+		}
+
+		void await_suspend(std::coroutine_handle<> p_handle)
+		{
+			_worker->schedule([p_handle]() { p_handle.resume(); });
+		}
+
+		void await_resume() const
+		{
+
+		}
+	};
+
+	inline WorkerAwaiter operator co_await(spk::PersistantWorker& p_worker)
+	{
+		return (WorkerAwaiter(&p_worker));
+	}
+
+	inline WorkerAwaiter operator co_await(spk::SafePointer<spk::PersistantWorker> p_worker)
+	{
+		return (WorkerAwaiter(p_worker.get()));
+	}
+
+	class NextFrameAwaiter
+	{
+	public:
+		bool await_ready() const
+		{
+			return (false);
+		}
+
+		void await_suspend(std::coroutine_handle<> p_handle)
+		{
+			spk::PersistantWorker* worker = spk::PersistantWorker::current();
+			if (worker == nullptr)
+				throw std::runtime_error("Unable to await the next frame outside of a persistant worker.");
+			worker->schedule([p_handle]() { p_handle.resume(); });
+		}
+
+		void await_resume() const
+		{
+
+		}
+	};
+
+	inline NextFrameAwaiter nextFrame()
+	{
+		return {};
+	}
+
+	class JobAwaiter
+	{
+	private:
+		spk::JobSystem::Handle _job;
+
+	public:
+		JobAwaiter(const spk::JobSystem::Handle& p_job) :
+			_job(p_job)
+		{
+
+		}
+
+		bool await_ready() const
+		{
+			return (_job.isValid() == false || _job.isDone() == true);
+		}
+
+		bool await_suspend(std::coroutine_handle<> p_handle)
+		{
+			spk::PersistantWorker* worker = spk::PersistantWorker::current();
+			if (worker != nullptr)
+			{
+				_job.onCompletion([worker, p_handle]() {
+						worker->schedule([p_handle]() { p_handle.resume(); });
+					});
+				return (true);
+			}
+
+			spk::JobSystem* jobSystem = spk::JobSystem::current();
+			if (jobSystem != nullptr)
+				jobSystem->wait(_job);
+			while (_job.isDone() == false)
+				std::this_thread::yield();
+			return (false);
+		}
+
+		void await_resume() const
+		{
+
+		}
+	};
+
+	inline JobAwaiter operator co_await(const spk::JobSystem::Handle& p_job)
+	{
+		return (JobAwaiter(p_job));
+	}
+}
\ No newline at end of file
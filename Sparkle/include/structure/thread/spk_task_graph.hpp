@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "structure/thread/spk_persistant_worker.hpp"
+
+namespace spk
+{
+	class TaskGraph
+	{
+	public:
+		using Job = spk::ContractProvider::Job;
+		using Contract = spk::ContractProvider::Contract;
+		using TaskID = size_t;
+
+	private:
+		static constexpr uint64_t CancelledFlag = uint64_t(1) << 63;
+
+		struct Dependency
+		{
+			TaskID task;
+			uint64_t frameLag;
+		};
+
+		struct Task
+		{
+			std::wstring name;
+			spk::PersistantWorker* worker;
+			Job job;
+			std::vector<Dependency> dependencies;
+			std::atomic<uint64_t> completedFrame = 0;
+		};
+
+		struct WorkerPlan
+		{
+			spk::PersistantWorker* worker = nullptr;
+			std::vector<TaskID> tasks;
+			uint64_t frame = 0;
+		};
+
+		std::vector<std::unique_ptr<Task>> _tasks;
+		std::vector<WorkerPlan> _plans;
+		// Resigning waits for the plans running on the workers, so nothing touches the graph once they are cleared
+		std::vector<Contract> _contracts;
+		std::atomic<bool> _isRunning = false;
+
+		std::vector<TaskID> _sortTasks() const;
+		bool _waitDependency(const Dependency& p_dependency, uint64_t p_frame);
+		void _executePlan(WorkerPlan& p_plan);
+
+	public:
+		TaskGraph() = default;
+		~TaskGraph();
+
+		TaskGraph(const TaskGraph& p_other) = delete;
+		TaskGraph& operator=(const TaskGraph& p_other) = delete;
+
+		TaskID addTask(const std::wstring& p_name, spk::PersistantWorker& p_worker, const Job& p_job);
+		void addDependency(TaskID p_task, TaskID p_dependency, uint64_t p_frameLag = 0);
+
+		void start();
+		void stop();
+
+		bool isRunning() const;
+		size_t size() const;
+		const std::wstring& name(TaskID p_task) const;
+		uint64_t completedFrame(TaskID p_task) const;
+	};
+}
\ No newline at end of file
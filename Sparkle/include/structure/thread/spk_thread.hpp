@@ -1,7 +1,9 @@
 #pragma once
 
 #include "structure/spk_iostream.hpp"
+#include "structure/thread/spk_thread_placement.hpp"
 
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 #include <functional>
@@ -16,14 +18,24 @@ namespace spk
 		std::wstring _name;
 		std::function<void()> _callback;
 		std::unique_ptr<std::thread> _handle = nullptr;
+		spk::ThreadPlacement _placement;
+		std::atomic<bool> _isPlacementApplied = false;
+
+	protected:
+		void _applyPlacement()
+		{
+			_isPlacementApplied = _placement.applyToCurrentThread();
+		}
 
 	public:
-		Thread(const std::wstring& p_name, const std::function<void()>& p_callback) :
+		Thread(const std::wstring& p_name, const std::function<void()>& p_callback, const spk::ThreadPlacement& p_placement = spk::ThreadPlacement()) :
 			_name(p_name),
 			_callback([&, p_name, p_callback]() {
 					spk::cout.setPrefix(p_name);
+					_applyPlacement();
 					p_callback();
-				})
+				}),
+			_placement(p_placement)
 		{
 
 		}
@@ -53,6 +65,22 @@ namespace spk
 			}
 		}
 
+		// Takes effect the next time the thread is started
+		void setPlacement(const spk::ThreadPlacement& p_placement)
+		{
+			_placement = p_placement;
+		}
+
+		const spk::ThreadPlacement& placement() const
+		{
+			return (_placement);
+		}
+
+		bool isPlacementApplied() const
+		{
+			return (_isPlacementApplied);
+		}
+
 		bool isJoinable() const
 		{
 			if (_handle == nullptr)
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace spk
+{
+	struct ThreadPlacement
+	{
+		enum class Priority
+		{
+			Lowest,
+			Low,
+			Normal,
+			High,
+			Highest
+		};
+
+		// RoundRobin and FirstInFirstOut are real-time policies and usually require elevated privileges
+		enum class Policy
+		{
+			Default,
+			Batch,
+			Idle,
+			RoundRobin,
+			FirstInFirstOut
+		};
+
+		static constexpr int AnyNumaNode = -1;
+
+		std::vector<size_t> cores;
+		int numaNode = AnyNumaNode;
+		Priority priority = Priority::Normal;
+		Policy policy = Policy::Default;
+
+		bool isDefault() const;
+		std::vector<size_t> allowedCores() const;
+		bool applyToCurrentThread() const;
+	};
+
+	class CpuTopology
+	{
+	public:
+		struct LogicalCore
+		{
+			size_t id;
+			size_t physicalCore;
+			size_t numaNode;
+		};
+
+	private:
+		std::vector<LogicalCore> _logicalCores;
+		size_t _nbPhysicalCore = 0;
+		size_t _nbNumaNode = 0;
+
+		static std::vector<LogicalCore> _detectLogicalCores();
+
+	public:
+		CpuTopology(const std::vector<LogicalCore>& p_logicalCores);
+
+		static const CpuTopology& local();
+		static size_t currentCore();
+
+		const std::vector<LogicalCore>& logicalCores() const;
+		size_t nbLogicalCore() const;
+		size_t nbPhysicalCore() const;
+		size_t nbNumaNode() const;
+
+		std::vector<size_t> coresOfNode(size_t p_numaNode) const;
+		std::vector<size_t> distribute(size_t p_nbThread) const;
+	};
+}
\ No newline at end of file
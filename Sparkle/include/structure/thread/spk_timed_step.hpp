@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "structure/design_pattern/spk_contract_provider.hpp"
+
+namespace spk
+{
+	class TimedStep
+	{
+	public:
+		using Job = spk::ContractProvider::Job;
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr size_t DefaultMaxCatchUpStep = 5;
+
+		struct Statistics
+		{
+			std::wstring name;
+			std::chrono::nanoseconds budget = std::chrono::nanoseconds(0);
+			std::chrono::nanoseconds timestep = std::chrono::nanoseconds(0);
+			uint64_t nbExecution = 0;
+			uint64_t nbOverrun = 0;
+			uint64_t nbDroppedStep = 0;
+			std::chrono::nanoseconds lastDuration = std::chrono::nanoseconds(0);
+			std::chrono::nanoseconds maxDuration = std::chrono::nanoseconds(0);
+			std::chrono::nanoseconds totalDuration = std::chrono::nanoseconds(0);
+
+			std::chrono::nanoseconds averageDuration() const
+			{
+				if (nbExecution == 0)
+					return (std::chrono::nanoseconds(0));
+				return (totalDuration / nbExecution);
+			}
+		};
+
+	private:
+		std::wstring _name;
+		Job _job;
+		std::chrono::nanoseconds _budget;
+		std::chrono::nanoseconds _timestep;
+		size_t _maxCatchUpStep;
+
+		bool _isStarted = false;
+		Clock::time_point _lastTime;
+		// Written by the executing worker only, but read by interpolation() from any thread
+		std::atomic<int64_t> _accumulator = 0;
+
+		std::atomic<uint64_t> _nbExecution = 0;
+		std::atomic<uint64_t> _nbOverrun = 0;
+		std::atomic<uint64_t> _nbDroppedStep = 0;
+		std::atomic<int64_t> _lastDuration = 0;
+		std::atomic<int64_t> _maxDuration = 0;
+		std::atomic<int64_t> _totalDuration = 0;
+
+		void _executeMeasured()
+		{
+			Clock::time_point start = Clock::now();
+			_job();
+			int64_t duration = (Clock::now() - start).count();
+
+			_nbExecution.fetch_add(1, std::memory_order_relaxed);
+			_lastDuration.store(duration, std::memory_order_relaxed);
+			_totalDuration.fetch_add(duration, std::memory_order_relaxed);
+			if (duration > _maxDuration.load(std::memory_order_relaxed))
+				_maxDuration.store(duration, std::memory_order_relaxed);
+			if (_budget.count() > 0 && duration > _budget.count())
+				_nbOverrun.fetch_add(1, std::memory_order_relaxed);
+		}
+
+	public:
+		TimedStep(const std::wstring& p_name, const Job& p_job, std::chrono::nanoseconds p_budget,
+			std::chrono::nanoseconds p_timestep = std::chrono::nanoseconds(0), size_t p_maxCatchUpStep = DefaultMaxCatchUpStep) :
+			_name(p_name),
+			_job(p_job),
+			_budget(p_budget),
+			_timestep(p_timestep),
+			_maxCatchUpStep(std::max<size_t>(p_maxCatchUpStep, 1))
+		{
+			if (_timestep.count() > 0 && _budget.count() == 0)
+				_budget = _timestep;
+		}
+
+		TimedStep(const TimedStep& p_other) = delete;
+		TimedStep& operator=(const TimedStep& p_other) = delete;
+
+		bool isFixed() const
+		{
+			return (_timestep.count() > 0);
+		}
+
+		const std::wstring& name() const
+		{
+			return (_name);
+		}
+
+		double interpolation() const
+		{
+			if (isFixed() == false)
+				return (0);
+			return (static_cast<double>(_accumulator.load(std::memory_order_relaxed)) / static_cast<double>(_timestep.count()));
+		}
+
+		void execute()
+		{
+			if (isFixed() == false)
+			{
+				_executeMeasured();
+				return;
+			}
+
+			Clock::time_point now = Clock::now();
+			if (_isStarted == false)
+			{
+				_isStarted = true;
+				_lastTime = now;
+			}
+
+			std::chrono::nanoseconds accumulator = std::chrono::nanoseconds(_accumulator.load(std::memory_order_relaxed)) + (now - _lastTime);
+			_lastTime = now;
+
+			for (size_t nbStep = 0; accumulator >= _timestep && nbStep < _maxCatchUpStep; nbStep++)
+			{
+				_executeMeasured();
+				accumulator -= _timestep;
+			}
+
+			if (accumulator >= _timestep)
+			{
+				_nbDroppedStep.fetch_add(static_cast<uint64_t>(accumulator / _timestep), std::memory_order_relaxed);
+				accumulator %= _timestep;
+			}
+			_accumulator.store(accumulator.count(), std::memory_order_relaxed);
+		}
+
+		Statistics statistics() const
+		{
+			Statistics result;
+
+			result.name = _name;
+			result.budget = _budget;
+			result.timestep = _timestep;
+			result.nbExecution = _nbExecution.load(std::memory_order_relaxed);
+			result.nbOverrun = _nbOverrun.load(std::memory_order_relaxed);
+			result.nbDroppedStep = _nbDroppedStep.load(std::memory_order_relaxed);
+			result.lastDuration = std::chrono::nanoseconds(_lastDuration.load(std::memory_order_relaxed));
+			result.maxDuration = std::chrono::nanoseconds(_maxDuration.load(std::memory_order_relaxed));
+			result.totalDuration = std::chrono::nanoseconds(_totalDuration.load(std::memory_order_relaxed));
+			return (result);
+		}
+	};
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "application/spk_application.hpp"
 
+#include <algorithm>
+
 namespace spk
 {
 	Application::Application()
@@ -30,6 +32,28 @@ namespace spk
 		return (_workers[MainThreadName]->addExecutionStep(p_job));
 	}
 
+	Application::Contract Application::addBudgetedStep(const std::wstring& p_threadName, const std::wstring& p_stepName, std::chrono::nanoseconds p_budget, const Job& p_job)
+	{
+		return (worker(p_threadName)->addBudgetedStep(p_stepName, p_budget, p_job));
+	}
+
+	Application::Contract Application::addBudgetedStep(const std::wstring& p_stepName, std::chrono::nanoseconds p_budget, const Job& p_job)
+	{
+		return (_mainThreadWorker->addBudgetedStep(p_stepName, p_budget, p_job));
+	}
+
+	Application::Contract Application::addFixedStep(const std::wstring& p_threadName, const std::wstring& p_stepName, std::chrono::nanoseconds p_timestep, const Job& p_job,
+		std::chrono::nanoseconds p_budget, size_t p_maxCatchUpStep)
+	{
+		return (worker(p_threadName)->addFixedStep(p_stepName, p_timestep, p_job, p_budget, p_maxCatchUpStep));
+	}
+
+	Application::Contract Application::addFixedStep(const std::wstring& p_stepName, std::chrono::nanoseconds p_timestep, const Job& p_job,
+		std::chrono::nanoseconds p_budget, size_t p_maxCatchUpStep)
+	{
+		return (_mainThreadWorker->addFixedStep(p_stepName, p_timestep, p_job, p_budget, p_maxCatchUpStep));
+	}
+
 	Application::PreparationContract Application::addPreparationStep(const std::wstring& p_threadName, const PreparationJob& p_job)
 	{
 		return (worker(p_threadName)->addPreparationStep(p_job));
@@ -40,12 +64,72 @@ namespace spk
 		return (_workers[MainThreadName]->addPreparationStep(p_job));
 	}
 
+	spk::JobSystem& Application::jobSystem()
+	{
+		std::call_once(_jobSystemFlag, [&]() {
+				size_t nbWorker = (_jobSystemPlacement.cores.empty() == true ? spk::JobSystem::defaultNbWorker() : _jobSystemPlacement.cores.size());
+				_jobSystem = std::make_unique<spk::JobSystem>(nbWorker, _jobSystemPlacement);
+			});
+		return (*_jobSystem);
+	}
+
+	void Application::placeWorkers(const spk::CpuTopology& p_topology)
+	{
+		if (_isRunning == true)
+			throw std::runtime_error("Unable to place the workers of a running application.");
+		if (_jobSystem != nullptr)
+			throw std::runtime_error("Unable to place the workers once the job system is created.");
+
+		std::vector<std::wstring> names;
+		for (auto& [key, worker] : _workers)
+		{
+			if (key != MainThreadName)
+				names.push_back(key);
+		}
+		std::sort(names.begin(), names.end());
+		names.insert(names.begin(), MainThreadName);
+
+		std::vector<size_t> cores = p_topology.distribute(names.size());
+		for (size_t i = 0; i < names.size(); i++)
+		{
+			spk::ThreadPlacement placement;
+			if (i < cores.size())
+				placement.cores = { cores[i] };
+			_workers[names[i]]->setPlacement(placement);
+		}
+
+		_jobSystemPlacement = spk::ThreadPlacement();
+		_jobSystemPlacement.priority = spk::ThreadPlacement::Priority::Low;
+		for (const spk::CpuTopology::LogicalCore& core : p_topology.logicalCores())
+		{
+			if (std::find(cores.begin(), cores.end(), core.id) == cores.end())
+				_jobSystemPlacement.cores.push_back(core.id);
+		}
+	}
+
+	spk::TaskGraph& Application::taskGraph()
+	{
+		return (_taskGraph);
+	}
+
+	spk::TaskGraph::TaskID Application::addGraphTask(const std::wstring& p_threadName, const std::wstring& p_taskName, const Job& p_job)
+	{
+		return (_taskGraph.addTask(p_taskName, *worker(p_threadName), p_job));
+	}
+
+	spk::TaskGraph::TaskID Application::addGraphTask(const std::wstring& p_taskName, const Job& p_job)
+	{
+		return (_taskGraph.addTask(p_taskName, *_mainThreadWorker, p_job));
+	}
+
 	int Application::run()
 	{
 		_isRunning = true;
 
 		try
 		{
+			_taskGraph.start();
+
 			for (auto& [key, worker] : _workers)
 			{
 				if (key != MainThreadName)
@@ -53,16 +137,24 @@ namespace spk
 			}
 
 			spk::cout.setPrefix(L"MainThread");
+			_mainThreadWorker->_applyPlacement();
+			_mainThreadWorker->_bindToCurrentThread();
 			_mainThreadWorker->preparationJobs().trigger();
+			_mainThreadWorker->_resetSchedule();
 			while (_isRunning == true)
 			{
-				_mainThreadWorker->executionJobs().trigger();
+				_mainThreadWorker->_executeIteration();
+				if (_isRunning == true)
+					_mainThreadWorker->_waitNextIteration();
 			}
 		}
 		catch (std::exception& e)
 		{
 			std::cout << e.what() << std::endl;
 		}
+		spk::PersistantWorker::_unbindCurrentThread();
+
+		_taskGraph.stop();
 
 		for (auto& [key, worker] : _workers)
 		{
@@ -70,13 +162,20 @@ namespace spk
 				worker->stop();
 		}
 
+		for (auto& [key, worker] : _workers)
+		{
+			if (key != MainThreadName && worker->isJoinable() == true)
+				worker->join();
+		}
+
 		return (_errorCode);
 	}
 
 	void Application::quit(int p_errorCode)
 	{
-		_isRunning = false;
 		_errorCode = p_errorCode;
+		_isRunning = false;
+		_mainThreadWorker->wakeUp();
 	}
 
 	bool Application::isRunning() const
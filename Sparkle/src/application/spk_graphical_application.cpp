@@ -34,12 +34,16 @@ namespace spk
 		}
 
 		this->addExecutionStep([&](){
-			while (_windowToRemove.empty() == false)
-			{
-				closeWindow(_windowToRemove.pop());
-				if (_windows.size() == 0)
-					quit(0);
-			}
+			std::vector<spk::SafePointer<Window>> windowsToRemove;
+
+			if (_windowToRemove.drainInto(windowsToRemove) == 0)
+				return;
+
+			for (spk::SafePointer<Window>& window : windowsToRemove)
+				closeWindow(window);
+
+			if (_windows.size() == 0)
+				quit(0);
 		}).relinquish();
 	}
 
@@ -0,0 +1,109 @@
+#include "structure/container/spk_chunked_data_buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace spk
+{
+	ChunkedDataBuffer::ChunkedDataBuffer(const size_t& p_chunkSize) :
+		_chunkSize(p_chunkSize),
+		_chunks(),
+		_size(0),
+		_bookmark(0),
+		_encoding(Encoding::Raw)
+	{
+		if (_chunkSize == 0)
+			throw std::runtime_error("Unable to create a chunked data buffer with empty chunks.");
+	}
+
+	void ChunkedDataBuffer::skip(const size_t& p_number)
+	{
+		if (leftover() < p_number)
+			throw std::runtime_error(std::string("Unable to skip ") + std::to_string(p_number) + " bytes.");
+		_bookmark += p_number;
+	}
+
+	void ChunkedDataBuffer::clear()
+	{
+		_chunks.clear();
+		_size = 0;
+		_bookmark = 0;
+	}
+
+	void ChunkedDataBuffer::reset()
+	{
+		_bookmark = 0;
+	}
+
+	void ChunkedDataBuffer::append(const void* p_data, const size_t& p_dataSize)
+	{
+		const uint8_t* source = static_cast<const uint8_t*>(p_data);
+		size_t remainingSize = p_dataSize;
+
+		while (remainingSize != 0)
+		{
+			size_t chunkOffset = _size % _chunkSize;
+
+			if (_size == _chunks.size() * _chunkSize)
+				_chunks.push_back(std::unique_ptr<uint8_t[]>(new uint8_t[_chunkSize]));
+
+			size_t copySize = std::min(remainingSize, _chunkSize - chunkOffset);
+			std::memcpy(_chunks.back().get() + chunkOffset, source, copySize);
+
+			source += copySize;
+			remainingSize -= copySize;
+			_size += copySize;
+		}
+	}
+
+	void ChunkedDataBuffer::extract(void* p_destination, const size_t& p_dataSize) const
+	{
+		if (leftover() < p_dataSize)
+			throw std::runtime_error("Unable to retrieve data buffer content.");
+
+		uint8_t* destination = static_cast<uint8_t*>(p_destination);
+		size_t remainingSize = p_dataSize;
+
+		while (remainingSize != 0)
+		{
+			size_t chunkIndex = _bookmark / _chunkSize;
+			size_t chunkOffset = _bookmark % _chunkSize;
+			size_t copySize = std::min(remainingSize, _chunkSize - chunkOffset);
+
+			std::memcpy(destination, _chunks[chunkIndex].get() + chunkOffset, copySize);
+
+			destination += copySize;
+			remainingSize -= copySize;
+			_bookmark += copySize;
+		}
+	}
+
+	DataBuffer ChunkedDataBuffer::flatten() const
+	{
+		DataBuffer result;
+
+		result.setEncoding(_encoding);
+		result.reserve(_size);
+		for (const DataBufferView& chunk : chunks())
+		{
+			result.append(chunk.data(), chunk.size());
+		}
+
+		return (result);
+	}
+
+	std::vector<DataBufferView> ChunkedDataBuffer::chunks() const
+	{
+		std::vector<DataBufferView> result;
+
+		result.reserve(_chunks.size());
+		for (size_t i = 0; i < _chunks.size(); i++)
+		{
+			result.emplace_back(_chunks[i].get(), std::min(_chunkSize, _size - i * _chunkSize), _encoding);
+		}
+
+		return (result);
+	}
+}
\ No newline at end of file
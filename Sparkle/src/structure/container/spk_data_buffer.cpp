@@ -1,21 +1,45 @@
 #include "structure/container/spk_data_buffer.hpp"
 
+#include "structure/container/spk_data_buffer_compressor.hpp"
+
+#include <algorithm>
+
 namespace spk
 {
 	DataBuffer::DataBuffer() :
 		_data(),
-		_bookmark(0)
+		_bookmark(0),
+		_encoding(Encoding::Raw)
 	{
 	}
 
 	DataBuffer::DataBuffer(size_t p_dataSize) :
-		_data(p_dataSize),
-		_bookmark(0)
+		_data(p_dataSize, 0),
+		_bookmark(0),
+		_encoding(Encoding::Raw)
+	{
+
+	}
+
+	void DataBuffer::_growFor(const size_t& p_additionalSize)
 	{
+		size_t requiredCapacity = _data.size() + p_additionalSize;
 
+		if (requiredCapacity > _data.capacity())
+			_data.reserve(std::max(requiredCapacity, _data.capacity() * 2));
+	}
+
+	void DataBuffer::reserve(const size_t& p_capacity)
+	{
+		_data.reserve(p_capacity);
 	}
 
 	void DataBuffer::resize(const size_t& p_newSize)
+	{
+		_data.resize(p_newSize, 0);
+	}
+
+	void DataBuffer::resizeForOverwrite(const size_t& p_newSize)
 	{
 		_data.resize(p_newSize);
 	}
@@ -37,4 +61,28 @@ namespace spk
 	{
 		_bookmark = 0;
 	}
+
+	DataBufferView DataBuffer::view() const
+	{
+		return (DataBufferView(_data.data(), _data.size(), _encoding));
+	}
+
+	DataBufferView DataBuffer::slice(const size_t& p_offset, const size_t& p_size) const
+	{
+		return (view().slice(p_offset, p_size));
+	}
+
+	DataBuffer DataBuffer::compress(const size_t& p_nbThread) const
+	{
+		DataBuffer result = DataBufferCompressor::compress(view(), p_nbThread);
+		result.setEncoding(_encoding);
+		return (result);
+	}
+
+	DataBuffer DataBuffer::decompress(const size_t& p_nbThread) const
+	{
+		DataBuffer result = DataBufferCompressor::decompress(view(), p_nbThread);
+		result.setEncoding(_encoding);
+		return (result);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,425 @@
+#include "structure/container/spk_data_buffer_compressor.hpp"
+
+#include "structure/thread/spk_thread.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace spk
+{
+	namespace
+	{
+		uint32_t readUInt32(const uint8_t* p_source)
+		{
+			uint32_t result;
+			std::memcpy(&result, p_source, sizeof(uint32_t));
+			return (result);
+		}
+
+		uint32_t hashSequence(uint32_t p_sequence, size_t p_hashLog)
+		{
+			return ((p_sequence * 2654435761u) >> (32 - p_hashLog));
+		}
+
+		uint8_t* writeLength(uint8_t* p_destination, size_t p_length)
+		{
+			while (p_length >= 255)
+			{
+				*p_destination++ = 255;
+				p_length -= 255;
+			}
+			*p_destination++ = static_cast<uint8_t>(p_length);
+			return (p_destination);
+		}
+
+		// Compression requests do not own threads: they share helpers started on demand, which sleep between requests
+		class HelperPool
+		{
+		private:
+			std::mutex _dispatchMutex;
+
+			std::mutex _mutex;
+			std::condition_variable _workCondition;
+			std::condition_variable _doneCondition;
+			std::vector<std::unique_ptr<spk::Thread>> _threads;
+			bool _isStopping = false;
+			uint64_t _generation = 0;
+			size_t _nbWantedHelper = 0;
+			size_t _nbRunningHelper = 0;
+
+			const std::function<void(size_t)>* _job = nullptr;
+			size_t _nbJob = 0;
+			std::atomic<size_t> _nextJob = 0;
+
+			void _runJobs()
+			{
+				for (size_t jobIndex = _nextJob.fetch_add(1); jobIndex < _nbJob; jobIndex = _nextJob.fetch_add(1))
+					(*_job)(jobIndex);
+			}
+
+			void _helperLoop()
+			{
+				uint64_t generation = 0;
+				std::unique_lock<std::mutex> lock(_mutex);
+
+				while (true)
+				{
+					_workCondition.wait(lock, [&]() { return (_isStopping == true || (_generation != generation && _nbWantedHelper != 0)); });
+					if (_isStopping == true)
+						return;
+
+					generation = _generation;
+					_nbWantedHelper--;
+					_nbRunningHelper++;
+					lock.unlock();
+					_runJobs();
+					lock.lock();
+					if (--_nbRunningHelper == 0)
+						_doneCondition.notify_all();
+				}
+			}
+
+		public:
+			~HelperPool()
+			{
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					_isStopping = true;
+				}
+				_workCondition.notify_all();
+				for (auto& thread : _threads)
+					thread->join();
+			}
+
+			// Runs the jobs on the calling thread alone when another request already uses the helpers
+			void run(size_t p_nbHelper, size_t p_nbJob, const std::function<void(size_t)>& p_job)
+			{
+				std::unique_lock<std::mutex> dispatchLock(_dispatchMutex, std::try_to_lock);
+				if (dispatchLock.owns_lock() == false)
+				{
+					for (size_t i = 0; i < p_nbJob; i++)
+						p_job(i);
+					return;
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					while (_threads.size() < p_nbHelper)
+					{
+						_threads.push_back(std::make_unique<spk::Thread>(L"Compressor #" + std::to_wstring(_threads.size()), [this]() { _helperLoop(); }));
+						_threads.back()->start();
+					}
+
+					_job = &p_job;
+					_nbJob = p_nbJob;
+					_nextJob = 0;
+					_nbWantedHelper = p_nbHelper;
+					_generation++;
+				}
+				_workCondition.notify_all();
+
+				_runJobs();
+
+				std::unique_lock<std::mutex> lock(_mutex);
+				_nbWantedHelper = 0;
+				_doneCondition.wait(lock, [&]() { return (_nbRunningHelper == 0); });
+				_job = nullptr;
+			}
+		};
+
+		HelperPool& helperPool()
+		{
+			static HelperPool result;
+			return (result);
+		}
+
+		size_t readLength(const uint8_t*& p_source, const uint8_t* p_sourceEnd, size_t p_length)
+		{
+			uint8_t byte = 255;
+			while (byte == 255)
+			{
+				if (p_source >= p_sourceEnd)
+					throw std::runtime_error("Unable to decompress, block is truncated.");
+				byte = *p_source++;
+				p_length += byte;
+			}
+			return (p_length);
+		}
+	}
+
+	size_t DataBufferCompressor::compressBound(size_t p_sourceSize)
+	{
+		return (p_sourceSize + p_sourceSize / 255 + 16);
+	}
+
+	size_t DataBufferCompressor::_compressBlock(const uint8_t* p_source, size_t p_sourceSize, uint8_t* p_destination)
+	{
+		std::vector<uint32_t> hashTable(static_cast<size_t>(1) << HashLog, 0);
+
+		uint8_t* destinationStart = p_destination;
+		size_t anchor = 0;
+		size_t position = 0;
+
+		auto emitSequence = [&](size_t p_literalLength, size_t p_matchLength, size_t p_offset)
+			{
+				uint8_t* token = p_destination++;
+				*token = static_cast<uint8_t>(std::min<size_t>(p_literalLength, 15) << 4);
+
+				if (p_literalLength >= 15)
+					p_destination = writeLength(p_destination, p_literalLength - 15);
+				std::memcpy(p_destination, p_source + anchor, p_literalLength);
+				p_destination += p_literalLength;
+
+				if (p_matchLength != 0)
+				{
+					*token |= static_cast<uint8_t>(std::min<size_t>(p_matchLength - MinMatchLength, 15));
+					*p_destination++ = static_cast<uint8_t>(p_offset & 0xFF);
+					*p_destination++ = static_cast<uint8_t>(p_offset >> 8);
+					if (p_matchLength - MinMatchLength >= 15)
+						p_destination = writeLength(p_destination, p_matchLength - MinMatchLength - 15);
+				}
+			};
+
+		if (p_sourceSize > MinMatchLength)
+		{
+			size_t matchLimit = p_sourceSize - MinMatchLength;
+
+			while (position <= matchLimit)
+			{
+				uint32_t sequence = readUInt32(p_source + position);
+				uint32_t& entry = hashTable[hashSequence(sequence, HashLog)];
+				size_t candidate = entry;
+				entry = static_cast<uint32_t>(position);
+
+				if (candidate < position && position - candidate <= MaxOffset && readUInt32(p_source + candidate) == sequence)
+				{
+					size_t matchLength = MinMatchLength;
+					while (position + matchLength < p_sourceSize && p_source[candidate + matchLength] == p_source[position + matchLength])
+						matchLength++;
+
+					emitSequence(position - anchor, matchLength, position - candidate);
+
+					position += matchLength;
+					anchor = position;
+				}
+				else
+				{
+					position++;
+				}
+			}
+		}
+
+		emitSequence(p_sourceSize - anchor, 0, 0);
+
+		return (static_cast<size_t>(p_destination - destinationStart));
+	}
+
+	void DataBufferCompressor::_decompressBlock(const uint8_t* p_source, size_t p_sourceSize, uint8_t* p_destination, size_t p_destinationSize)
+	{
+		const uint8_t* sourceEnd = p_source + p_sourceSize;
+		uint8_t* destinationStart = p_destination;
+		uint8_t* destinationEnd = p_destination + p_destinationSize;
+
+		while (p_source < sourceEnd)
+		{
+			uint8_t token = *p_source++;
+
+			size_t literalLength = token >> 4;
+			if (literalLength == 15)
+				literalLength = readLength(p_source, sourceEnd, literalLength);
+
+			if (literalLength > static_cast<size_t>(sourceEnd - p_source) || literalLength > static_cast<size_t>(destinationEnd - p_destination))
+				throw std::runtime_error("Unable to decompress, literals are out of bound.");
+			std::memcpy(p_destination, p_source, literalLength);
+			p_source += literalLength;
+			p_destination += literalLength;
+
+			if (p_source == sourceEnd)
+				break;
+
+			if (sourceEnd - p_source < 2)
+				throw std::runtime_error("Unable to decompress, block is truncated.");
+			size_t offset = static_cast<size_t>(p_source[0]) | (static_cast<size_t>(p_source[1]) << 8);
+			p_source += 2;
+
+			size_t matchLength = token & 0x0F;
+			if (matchLength == 15)
+				matchLength = readLength(p_source, sourceEnd, matchLength);
+			matchLength += MinMatchLength;
+
+			if (offset == 0 || offset > static_cast<size_t>(p_destination - destinationStart) || matchLength > static_cast<size_t>(destinationEnd - p_destination))
+				throw std::runtime_error("Unable to decompress, match is out of bound.");
+
+			const uint8_t* match = p_destination - offset;
+			if (offset >= matchLength)
+			{
+				std::memcpy(p_destination, match, matchLength);
+				p_destination += matchLength;
+			}
+			else
+			{
+				for (size_t i = 0; i < matchLength; i++)
+					*p_destination++ = *match++;
+			}
+		}
+
+		if (p_destination != destinationEnd)
+			throw std::runtime_error("Unable to decompress, block size mismatch.");
+	}
+
+	template <typename TJob>
+	void DataBufferCompressor::_dispatch(size_t p_nbJob, size_t p_nbThread, const TJob& p_job)
+	{
+		size_t nbWorker = std::min(p_nbThread, p_nbJob);
+
+		if (nbWorker <= 1)
+		{
+			for (size_t i = 0; i < p_nbJob; i++)
+				p_job(i);
+			return;
+		}
+
+		std::exception_ptr error = nullptr;
+		std::atomic<bool> hasFailed = false;
+		std::atomic_flag errorLock = ATOMIC_FLAG_INIT;
+
+		helperPool().run(nbWorker - 1, p_nbJob, [&](size_t p_jobIndex) {
+				if (hasFailed.load(std::memory_order_relaxed) == true)
+					return;
+
+				try
+				{
+					p_job(p_jobIndex);
+				}
+				catch (...)
+				{
+					if (errorLock.test_and_set() == false)
+						error = std::current_exception();
+					hasFailed = true;
+				}
+			});
+
+		if (error != nullptr)
+			std::rethrow_exception(error);
+	}
+
+	DataBuffer DataBufferCompressor::compress(const DataBufferView& p_source, size_t p_nbThread, size_t p_blockSize)
+	{
+		if (p_blockSize == 0 || p_blockSize > MaxBlockSize)
+			throw std::runtime_error("Unable to compress, invalid block size.");
+
+		const uint8_t* source = p_source.data();
+		size_t sourceSize = p_source.size();
+		size_t nbBlock = (sourceSize + p_blockSize - 1) / p_blockSize;
+
+		std::vector<DataBuffer> compressedBlocks(nbBlock);
+
+		_dispatch(nbBlock, p_nbThread, [&](size_t p_blockIndex)
+			{
+				size_t blockOffset = p_blockIndex * p_blockSize;
+				size_t blockSize = std::min(p_blockSize, sourceSize - blockOffset);
+				DataBuffer& compressedBlock = compressedBlocks[p_blockIndex];
+
+				compressedBlock.resizeForOverwrite(compressBound(blockSize));
+				size_t compressedSize = _compressBlock(source + blockOffset, blockSize, compressedBlock.data());
+
+				if (compressedSize >= blockSize)
+				{
+					compressedBlock.resize(blockSize);
+					std::memcpy(compressedBlock.data(), source + blockOffset, blockSize);
+				}
+				else
+				{
+					compressedBlock.resize(compressedSize);
+				}
+			});
+
+		DataBuffer result;
+		size_t resultSize = sizeof(uint32_t) + sizeof(uint64_t) + 2 * sizeof(uint32_t) + nbBlock * sizeof(uint32_t);
+		for (const DataBuffer& compressedBlock : compressedBlocks)
+			resultSize += compressedBlock.size();
+		result.reserve(resultSize);
+
+		result << Magic << static_cast<uint64_t>(sourceSize) << static_cast<uint32_t>(p_blockSize) << static_cast<uint32_t>(nbBlock);
+		for (size_t i = 0; i < nbBlock; i++)
+		{
+			size_t blockSize = std::min(p_blockSize, sourceSize - i * p_blockSize);
+			uint32_t header = static_cast<uint32_t>(compressedBlocks[i].size());
+			if (compressedBlocks[i].size() == blockSize)
+				header |= StoredBlockFlag;
+			result << header;
+		}
+		for (const DataBuffer& compressedBlock : compressedBlocks)
+			result.append(compressedBlock.data(), compressedBlock.size());
+
+		return (result);
+	}
+
+	DataBuffer DataBufferCompressor::decompress(const DataBufferView& p_source, size_t p_nbThread)
+	{
+		DataBufferView reader(p_source.data(), p_source.size());
+
+		uint32_t magic;
+		uint64_t originalSize;
+		uint32_t blockSize;
+		uint32_t nbBlock;
+		reader >> magic >> originalSize >> blockSize >> nbBlock;
+
+		if (magic != Magic)
+			throw std::runtime_error("Unable to decompress, buffer is not a compressed data buffer.");
+		if (blockSize == 0 || blockSize > MaxBlockSize)
+			throw std::runtime_error("Unable to decompress, block size is corrupted.");
+		if (originalSize / MaxCompressionRatio > p_source.size())
+			throw std::runtime_error("Unable to decompress, original size exceeds what the buffer can encode.");
+		if (originalSize / blockSize + (originalSize % blockSize != 0 ? 1 : 0) != nbBlock)
+			throw std::runtime_error("Unable to decompress, header is corrupted.");
+		if (reader.leftover() < static_cast<size_t>(nbBlock) * sizeof(uint32_t))
+			throw std::runtime_error("Unable to decompress, block table is truncated.");
+
+		std::vector<uint32_t> blockHeaders(nbBlock);
+		std::vector<size_t> blockOffsets(nbBlock);
+		for (size_t i = 0; i < nbBlock; i++)
+			reader >> blockHeaders[i];
+
+		size_t offset = reader.bookmark();
+		for (size_t i = 0; i < nbBlock; i++)
+		{
+			blockOffsets[i] = offset;
+			offset += blockHeaders[i] & ~StoredBlockFlag;
+		}
+		if (offset > p_source.size())
+			throw std::runtime_error("Unable to decompress, blocks are truncated.");
+
+		DataBuffer result;
+		result.resizeForOverwrite(static_cast<size_t>(originalSize));
+
+		_dispatch(nbBlock, p_nbThread, [&](size_t p_blockIndex)
+			{
+				size_t compressedSize = blockHeaders[p_blockIndex] & ~StoredBlockFlag;
+				size_t decompressedOffset = p_blockIndex * static_cast<size_t>(blockSize);
+				size_t decompressedSize = std::min(static_cast<size_t>(blockSize), static_cast<size_t>(originalSize) - decompressedOffset);
+				const uint8_t* source = p_source.data() + blockOffsets[p_blockIndex];
+
+				if ((blockHeaders[p_blockIndex] & StoredBlockFlag) != 0)
+				{
+					if (compressedSize != decompressedSize)
+						throw std::runtime_error("Unable to decompress, stored block size mismatch.");
+					std::memcpy(result.data() + decompressedOffset, source, decompressedSize);
+				}
+				else
+				{
+					_decompressBlock(source, compressedSize, result.data() + decompressedOffset, decompressedSize);
+				}
+			});
+
+		return (result);
+	}
+}
\ No newline at end of file
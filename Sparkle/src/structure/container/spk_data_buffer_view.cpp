@@ -0,0 +1,49 @@
+#include "structure/container/spk_data_buffer_view.hpp"
+
+#include <cstring>
+
+namespace spk
+{
+	DataBufferView::DataBufferView() :
+		_data(nullptr),
+		_size(0),
+		_bookmark(0),
+		_encoding(Encoding::Raw)
+	{
+	}
+
+	DataBufferView::DataBufferView(const void* p_data, size_t p_size, const Encoding& p_encoding) :
+		_data(static_cast<const uint8_t*>(p_data)),
+		_size(p_size),
+		_bookmark(0),
+		_encoding(p_encoding)
+	{
+	}
+
+	void DataBufferView::skip(const size_t& p_number)
+	{
+		if (leftover() < p_number)
+			throw std::runtime_error(std::string("Unable to skip ") + std::to_string(p_number) + " bytes.");
+		_bookmark += p_number;
+	}
+
+	void DataBufferView::reset()
+	{
+		_bookmark = 0;
+	}
+
+	void DataBufferView::extract(void* p_destination, const size_t& p_dataSize) const
+	{
+		if (leftover() < p_dataSize)
+			throw std::runtime_error("Unable to retrieve data buffer content.");
+		std::memcpy(p_destination, _data + _bookmark, p_dataSize);
+		_bookmark += p_dataSize;
+	}
+
+	DataBufferView DataBufferView::slice(const size_t& p_offset, const size_t& p_size) const
+	{
+		if (p_offset > size() || p_size > size() - p_offset)
+			throw std::runtime_error("Unable to slice, range is out of bound.");
+		return (DataBufferView(_data + p_offset, p_size, _encoding));
+	}
+}
\ No newline at end of file
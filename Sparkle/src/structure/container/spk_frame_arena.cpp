@@ -0,0 +1,81 @@
+#include "structure/container/spk_frame_arena.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace spk
+{
+	FrameArena::FrameArena(size_t p_blockSize) :
+		_blockSize(p_blockSize),
+		_currentBlock(0),
+		_offset(0),
+		_used(0),
+		_highWaterMark(0),
+		_nbAllocation(0),
+		_nbReset(0)
+	{
+		if (_blockSize == 0)
+			throw std::runtime_error("Unable to create a frame arena with empty blocks.");
+	}
+
+	void* FrameArena::do_allocate(size_t p_bytes, size_t p_alignment)
+	{
+		while (_currentBlock < _blocks.size())
+		{
+			Block& block = _blocks[_currentBlock];
+			uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+			size_t alignedOffset = ((base + _offset + p_alignment - 1) & ~(static_cast<uintptr_t>(p_alignment) - 1)) - base;
+
+			if (alignedOffset + p_bytes <= block.size)
+			{
+				_used += (alignedOffset - _offset) + p_bytes;
+				_offset = alignedOffset + p_bytes;
+				_nbAllocation++;
+				_highWaterMark = std::max(_highWaterMark, _used);
+				return (block.data.get() + alignedOffset);
+			}
+
+			_used += block.size - _offset;
+			_currentBlock++;
+			_offset = 0;
+		}
+
+		size_t blockSize = std::max(_blockSize, p_bytes + p_alignment);
+		_blocks.push_back(Block{ std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize });
+		return (do_allocate(p_bytes, p_alignment));
+	}
+
+	void FrameArena::do_deallocate(void*, size_t, size_t)
+	{
+
+	}
+
+	bool FrameArena::do_is_equal(const std::pmr::memory_resource& p_other) const noexcept
+	{
+		return (this == &p_other);
+	}
+
+	void FrameArena::reset()
+	{
+		if (_blocks.size() > 1)
+		{
+			size_t totalSize = capacity();
+			_blocks.clear();
+			_blocks.push_back(Block{ std::make_unique_for_overwrite<std::byte[]>(totalSize), totalSize });
+		}
+
+		_currentBlock = 0;
+		_offset = 0;
+		_used = 0;
+		_nbAllocation = 0;
+		_nbReset++;
+	}
+
+	size_t FrameArena::capacity() const
+	{
+		size_t result = 0;
+		for (const Block& block : _blocks)
+			result += block.size;
+		return (result);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include "structure/container/spk_mapped_data_buffer.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace spk
+{
+	MappedDataBuffer::MappedDataBuffer() :
+		DataBufferView()
+	{
+	}
+
+	MappedDataBuffer::MappedDataBuffer(const std::filesystem::path& p_path, const AccessPattern& p_accessPattern) :
+		DataBufferView()
+	{
+		open(p_path, p_accessPattern);
+	}
+
+	MappedDataBuffer::~MappedDataBuffer()
+	{
+		_release();
+	}
+
+	MappedDataBuffer::MappedDataBuffer(MappedDataBuffer&& p_other) noexcept :
+		DataBufferView()
+	{
+		*this = std::move(p_other);
+	}
+
+	MappedDataBuffer& MappedDataBuffer::operator=(MappedDataBuffer&& p_other) noexcept
+	{
+		if (this != &p_other)
+		{
+			_release();
+
+			DataBufferView::operator=(p_other);
+			_path = std::move(p_other._path);
+			_mappedData = p_other._mappedData;
+			_mappedSize = p_other._mappedSize;
+#ifdef _WIN32
+			_fileHandle = p_other._fileHandle;
+			_mappingHandle = p_other._mappingHandle;
+			p_other._fileHandle = nullptr;
+			p_other._mappingHandle = nullptr;
+#endif
+			p_other._mappedData = nullptr;
+			p_other._mappedSize = 0;
+			p_other.DataBufferView::operator=(DataBufferView());
+		}
+		return (*this);
+	}
+
+	void MappedDataBuffer::open(const std::filesystem::path& p_path, const AccessPattern& p_accessPattern)
+	{
+		close();
+
+#ifdef _WIN32
+		DWORD flags = FILE_ATTRIBUTE_NORMAL;
+		if (p_accessPattern == AccessPattern::Sequential)
+			flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+		else if (p_accessPattern == AccessPattern::Random)
+			flags |= FILE_FLAG_RANDOM_ACCESS;
+
+		HANDLE fileHandle = CreateFileW(p_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("Unable to open file [" + p_path.string() + "]");
+
+		LARGE_INTEGER fileSize;
+		if (GetFileSizeEx(fileHandle, &fileSize) == FALSE)
+		{
+			CloseHandle(fileHandle);
+			throw std::runtime_error("Unable to retrieve the size of file [" + p_path.string() + "]");
+		}
+
+		_fileHandle = fileHandle;
+		_mappedSize = static_cast<size_t>(fileSize.QuadPart);
+
+		if (_mappedSize != 0)
+		{
+			_mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (_mappingHandle == nullptr)
+			{
+				_release();
+				throw std::runtime_error("Unable to create a mapping of file [" + p_path.string() + "]");
+			}
+
+			_mappedData = MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+			if (_mappedData == nullptr)
+			{
+				_release();
+				throw std::runtime_error("Unable to map file [" + p_path.string() + "]");
+			}
+		}
+#else
+		int fileDescriptor = ::open(p_path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fileDescriptor < 0)
+			throw std::runtime_error("Unable to open file [" + p_path.string() + "]");
+
+		struct stat fileStat;
+		if (fstat(fileDescriptor, &fileStat) != 0)
+		{
+			::close(fileDescriptor);
+			throw std::runtime_error("Unable to retrieve the size of file [" + p_path.string() + "]");
+		}
+
+		_mappedSize = static_cast<size_t>(fileStat.st_size);
+
+		if (_mappedSize != 0)
+		{
+			void* mappedData = mmap(nullptr, _mappedSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (mappedData == MAP_FAILED)
+			{
+				::close(fileDescriptor);
+				_mappedSize = 0;
+				throw std::runtime_error("Unable to map file [" + p_path.string() + "]");
+			}
+			_mappedData = mappedData;
+		}
+		::close(fileDescriptor);
+#endif
+
+		_path = p_path;
+		DataBufferView::operator=(DataBufferView(_mappedData, _mappedSize, encoding()));
+
+		if (p_accessPattern != AccessPattern::Normal)
+			advise(p_accessPattern);
+	}
+
+	void MappedDataBuffer::close()
+	{
+		_release();
+		_path.clear();
+		DataBufferView::operator=(DataBufferView(nullptr, 0, encoding()));
+	}
+
+	void MappedDataBuffer::_release()
+	{
+#ifdef _WIN32
+		if (_mappedData != nullptr)
+			UnmapViewOfFile(_mappedData);
+		if (_mappingHandle != nullptr)
+			CloseHandle(_mappingHandle);
+		if (_fileHandle != nullptr)
+			CloseHandle(_fileHandle);
+		_mappingHandle = nullptr;
+		_fileHandle = nullptr;
+#else
+		if (_mappedData != nullptr)
+			munmap(_mappedData, _mappedSize);
+#endif
+		_mappedData = nullptr;
+		_mappedSize = 0;
+	}
+
+	bool MappedDataBuffer::isOpen() const
+	{
+		return (_path.empty() == false);
+	}
+
+	const std::filesystem::path& MappedDataBuffer::path() const
+	{
+		return (_path);
+	}
+
+	void MappedDataBuffer::advise(const AccessPattern& p_accessPattern)
+	{
+		advise(0, _mappedSize, p_accessPattern);
+	}
+
+	void MappedDataBuffer::advise(const size_t& p_offset, const size_t& p_size, const AccessPattern& p_accessPattern)
+	{
+		if (p_offset > _mappedSize || p_size > _mappedSize - p_offset)
+			throw std::runtime_error("Unable to advise, range is out of bound.");
+		if (_mappedData == nullptr || p_size == 0)
+			return;
+
+#ifdef _WIN32
+		if (p_accessPattern == AccessPattern::WillNeed)
+		{
+			WIN32_MEMORY_RANGE_ENTRY range;
+			range.VirtualAddress = static_cast<uint8_t*>(_mappedData) + p_offset;
+			range.NumberOfBytes = p_size;
+			PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+		}
+#else
+		static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+		size_t alignedOffset = p_offset - (p_offset % pageSize);
+		size_t alignedSize = p_size + (p_offset - alignedOffset);
+
+		int advice = MADV_NORMAL;
+		switch (p_accessPattern)
+		{
+		case AccessPattern::Sequential:
+			advice = MADV_SEQUENTIAL; break;
+		case AccessPattern::Random:
+			advice = MADV_RANDOM; break;
+		case AccessPattern::WillNeed:
+			advice = MADV_WILLNEED; break;
+		default:
+			break;
+		}
+		madvise(static_cast<uint8_t*>(_mappedData) + alignedOffset, alignedSize, advice);
+#endif
+	}
+}
\ No newline at end of file
@@ -26,12 +26,12 @@ namespace spk
 		return state();
 	}
 
-	ActivableObject::Contract ActivableObject::addActivationCallback(const std::function<void()>& p_callback)
+	ActivableObject::Contract ActivableObject::addActivationCallback(const Job& p_callback)
 	{
 		return (StatefulObject<bool>::addCallback(true, p_callback));
 	}
 
-	ActivableObject::Contract ActivableObject::addDeactivationCallback(const std::function<void()>& p_callback)
+	ActivableObject::Contract ActivableObject::addDeactivationCallback(const Job& p_callback)
 	{
 		return (StatefulObject<bool>::addCallback(false, p_callback));
 	}
@@ -0,0 +1,42 @@
+#include "structure/thread/spk_asymmetric_fence.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace spk
+{
+	bool AsymmetricFence::_registerHeavyFence()
+	{
+#ifdef _WIN32
+		return (true);
+#elif defined(__linux__) && defined(__NR_membarrier)
+		return (syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0);
+#else
+		return (false);
+#endif
+	}
+
+	void AsymmetricFence::heavy()
+	{
+		if (_isHeavyFenceSupported() == false)
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			return;
+		}
+
+#ifdef _WIN32
+		FlushProcessWriteBuffers();
+#elif defined(__linux__) && defined(__NR_membarrier)
+		if (syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0) != 0)
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+	}
+}
\ No newline at end of file
@@ -0,0 +1,302 @@
+#include "structure/thread/spk_job_system.hpp"
+
+#include <functional>
+#include <stdexcept>
+
+namespace spk
+{
+	JobSystem::Handle::Handle(Task* p_task) :
+		_task(p_task)
+	{
+		_task->nbReference.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	JobSystem::Handle::Handle(const Handle& p_other) :
+		_task(p_other._task)
+	{
+		if (_task != nullptr)
+			_task->nbReference.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	JobSystem::Handle::Handle(Handle&& p_other) noexcept :
+		_task(std::exchange(p_other._task, nullptr))
+	{
+
+	}
+
+	JobSystem::Handle& JobSystem::Handle::operator=(const Handle& p_other)
+	{
+		if (this != &p_other)
+		{
+			Handle copy(p_other);
+			std::swap(_task, copy._task);
+		}
+		return (*this);
+	}
+
+	JobSystem::Handle& JobSystem::Handle::operator=(Handle&& p_other) noexcept
+	{
+		if (this != &p_other)
+		{
+			if (_task != nullptr)
+				JobSystem::_release(_task);
+			_task = std::exchange(p_other._task, nullptr);
+		}
+		return (*this);
+	}
+
+	JobSystem::Handle::~Handle()
+	{
+		if (_task != nullptr)
+			JobSystem::_release(_task);
+	}
+
+	bool JobSystem::Handle::isValid() const
+	{
+		return (_task != nullptr);
+	}
+
+	bool JobSystem::Handle::isDone() const
+	{
+		return (_task == nullptr || _task->nbPending.load(std::memory_order_acquire) == 0);
+	}
+
+	void JobSystem::Handle::onCompletion(Job&& p_callback) const
+	{
+		if (_task == nullptr)
+			throw std::runtime_error("Unable to register a completion callback on an empty handle.");
+		if (p_callback == nullptr)
+			throw std::runtime_error("Unable to register an empty completion callback.");
+
+		uint32_t state = _task->completionState.load(std::memory_order_acquire);
+		if (state == Task::CallbackRegistered)
+			throw std::runtime_error("Unable to register a second completion callback on a job.");
+		if (state == Task::Completed)
+		{
+			p_callback();
+			return;
+		}
+
+		_task->completionCallback = std::move(p_callback);
+		if (_task->completionState.compare_exchange_strong(state, Task::CallbackRegistered, std::memory_order_acq_rel, std::memory_order_acquire) == false)
+		{
+			// The job completed in the meantime, without seeing the callback
+			Job callback = std::move(_task->completionCallback);
+			callback();
+		}
+	}
+
+	size_t JobSystem::defaultNbWorker()
+	{
+		unsigned int hardwareConcurrency = std::thread::hardware_concurrency();
+
+		// The thread calling wait() or parallelFor() executes jobs too, so it takes one of the cores
+		return (hardwareConcurrency > 1 ? hardwareConcurrency - 1 : 1);
+	}
+
+	JobSystem::JobSystem(size_t p_nbWorker, const spk::ThreadPlacement& p_placement)
+	{
+		if (p_nbWorker == 0)
+			throw std::runtime_error("Unable to create a job system without worker.");
+
+		_isRunning = true;
+		for (size_t i = 0; i < p_nbWorker; i++)
+			_workers.push_back(std::make_unique<Worker>());
+
+		for (size_t i = 0; i < p_nbWorker; i++)
+		{
+			_workers[i]->thread = std::make_unique<spk::Thread>(L"JobWorker " + std::to_wstring(i), [this, i]() {
+					_workerLoop(i);
+				}, p_placement);
+			_workers[i]->thread->start();
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		_isRunning = false;
+		_workEpoch.fetch_add(1, std::memory_order_seq_cst);
+		_workEpoch.notify_all();
+
+		for (auto& worker : _workers)
+			worker->thread->join();
+
+		Task* task = nullptr;
+		while ((task = _findTask()) != nullptr)
+			_release(task);
+	}
+
+	JobSystem* JobSystem::current()
+	{
+		return (_currentSystem);
+	}
+
+	size_t JobSystem::nbWorker() const
+	{
+		return (_workers.size());
+	}
+
+	void JobSystem::_release(Task* p_task)
+	{
+		if (p_task->nbReference.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			delete p_task;
+	}
+
+	void JobSystem::_notifyWorkers()
+	{
+		_workEpoch.fetch_add(1, std::memory_order_seq_cst);
+		if (_nbSleepingWorker.load(std::memory_order_seq_cst) != 0)
+			_workEpoch.notify_one();
+	}
+
+	void JobSystem::_schedule(Task* p_task)
+	{
+		if (_currentSystem == this && _currentWorkerIndex != NoWorker)
+		{
+			_workers[_currentWorkerIndex]->tasks.push(p_task);
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(_injectionMutex);
+			_injectedTasks.push_back(p_task);
+			_nbInjectedTask.fetch_add(1, std::memory_order_release);
+		}
+		_notifyWorkers();
+	}
+
+	JobSystem::Task* JobSystem::_findTask()
+	{
+		size_t workerIndex = (_currentSystem == this ? _currentWorkerIndex : NoWorker);
+
+		if (workerIndex != NoWorker)
+		{
+			std::optional<Task*> task = _workers[workerIndex]->tasks.pop();
+			if (task.has_value() == true)
+				return (task.value());
+		}
+
+		if (_nbInjectedTask.load(std::memory_order_acquire) != 0)
+		{
+			std::lock_guard<std::mutex> lock(_injectionMutex);
+			if (_injectedTasks.empty() == false)
+			{
+				Task* result = _injectedTasks.front();
+				_injectedTasks.pop_front();
+				_nbInjectedTask.fetch_sub(1, std::memory_order_relaxed);
+				return (result);
+			}
+		}
+
+		static thread_local uint32_t seed = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+
+		size_t nbWorker = _workers.size();
+		size_t firstVictim = seed % nbWorker;
+		for (size_t i = 0; i < nbWorker; i++)
+		{
+			size_t victim = (firstVictim + i) % nbWorker;
+			if (victim == workerIndex)
+				continue;
+
+			std::optional<Task*> task = _workers[victim]->tasks.steal();
+			if (task.has_value() == true)
+				return (task.value());
+		}
+
+		return (nullptr);
+	}
+
+	void JobSystem::_execute(Task* p_task)
+	{
+		Task* previousTask = _currentTask;
+
+		_currentTask = p_task;
+		p_task->job();
+		_currentTask = previousTask;
+
+		_finish(p_task);
+	}
+
+	void JobSystem::_finish(Task* p_task)
+	{
+		while (p_task != nullptr && p_task->nbPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Task* parent = p_task->parent;
+			p_task->job.reset();
+			if (p_task->completionState.exchange(Task::Completed, std::memory_order_acq_rel) == Task::CallbackRegistered)
+			{
+				p_task->completionCallback();
+				p_task->completionCallback.reset();
+			}
+			_release(p_task);
+			p_task = parent;
+		}
+	}
+
+	void JobSystem::_workerLoop(size_t p_index)
+	{
+		_currentSystem = this;
+		_currentWorkerIndex = p_index;
+
+		size_t nbFailedAttempt = 0;
+		while (_isRunning.load(std::memory_order_acquire) == true)
+		{
+			uint32_t epoch = _workEpoch.load(std::memory_order_seq_cst);
+
+			Task* task = _findTask();
+			if (task != nullptr)
+			{
+				_execute(task);
+				nbFailedAttempt = 0;
+				continue;
+			}
+
+			if (++nbFailedAttempt < NbSpinBeforeSleep)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			_nbSleepingWorker.fetch_add(1, std::memory_order_seq_cst);
+			_workEpoch.wait(epoch, std::memory_order_seq_cst);
+			_nbSleepingWorker.fetch_sub(1, std::memory_order_seq_cst);
+		}
+
+		_currentWorkerIndex = NoWorker;
+		_currentSystem = nullptr;
+	}
+
+	JobSystem::Handle JobSystem::submit(Job&& p_job)
+	{
+		if (p_job == nullptr)
+			throw std::runtime_error("Unable to submit an empty job.");
+
+		Task* task = new Task();
+		task->job = std::move(p_job);
+		task->system = this;
+
+		if (_currentTask != nullptr && _currentTask->system == this)
+		{
+			task->parent = _currentTask;
+			_currentTask->nbPending.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Handle result(task);
+		_schedule(task);
+		return (result);
+	}
+
+	void JobSystem::wait(const Handle& p_handle)
+	{
+		while (p_handle.isDone() == false)
+		{
+			Task* task = _findTask();
+			if (task != nullptr)
+				_execute(task);
+			else
+				std::this_thread::yield();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "structure/thread/spk_task_graph.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace spk
+{
+	TaskGraph::~TaskGraph()
+	{
+		stop();
+	}
+
+	TaskGraph::TaskID TaskGraph::addTask(const std::wstring& p_name, spk::PersistantWorker& p_worker, const Job& p_job)
+	{
+		if (_isRunning == true)
+			throw std::runtime_error("Unable to add a task to a running task graph.");
+
+		std::unique_ptr<Task> task = std::make_unique<Task>();
+		task->name = p_name;
+		task->worker = &p_worker;
+		task->job = p_job;
+		_tasks.push_back(std::move(task));
+
+		return (_tasks.size() - 1);
+	}
+
+	void TaskGraph::addDependency(TaskID p_task, TaskID p_dependency, uint64_t p_frameLag)
+	{
+		if (_isRunning == true)
+			throw std::runtime_error("Unable to add a dependency to a running task graph.");
+		if (p_task >= _tasks.size() || p_dependency >= _tasks.size())
+			throw std::runtime_error("Unable to add a dependency between unknown tasks.");
+		if (p_task == p_dependency && p_frameLag == 0)
+			throw std::runtime_error("Unable to make a task depend on itself within the same frame.");
+
+		_tasks[p_task]->dependencies.push_back(Dependency{ p_dependency, p_frameLag });
+	}
+
+	std::vector<TaskGraph::TaskID> TaskGraph::_sortTasks() const
+	{
+		std::vector<size_t> nbPendingDependency(_tasks.size(), 0);
+		std::vector<std::vector<TaskID>> dependents(_tasks.size());
+
+		for (TaskID task = 0; task < _tasks.size(); task++)
+		{
+			for (const Dependency& dependency : _tasks[task]->dependencies)
+			{
+				if (dependency.frameLag != 0)
+					continue;
+				nbPendingDependency[task]++;
+				dependents[dependency.task].push_back(task);
+			}
+		}
+
+		std::vector<TaskID> result;
+		result.reserve(_tasks.size());
+		for (TaskID task = 0; task < _tasks.size(); task++)
+		{
+			if (nbPendingDependency[task] == 0)
+				result.push_back(task);
+		}
+
+		for (size_t i = 0; i < result.size(); i++)
+		{
+			for (TaskID dependent : dependents[result[i]])
+			{
+				if (--nbPendingDependency[dependent] == 0)
+					result.push_back(dependent);
+			}
+		}
+
+		if (result.size() != _tasks.size())
+			throw std::runtime_error("Unable to start task graph, dependencies contain a cycle.");
+		return (result);
+	}
+
+	void TaskGraph::start()
+	{
+		if (_isRunning == true)
+			return;
+
+		std::vector<TaskID> order = _sortTasks();
+
+		_plans.clear();
+		for (TaskID task : order)
+		{
+			_tasks[task]->completedFrame.store(0, std::memory_order_relaxed);
+
+			auto it = std::find_if(_plans.begin(), _plans.end(), [&](const WorkerPlan& p_plan) {
+					return (p_plan.worker == _tasks[task]->worker);
+				});
+			if (it == _plans.end())
+			{
+				_plans.push_back(WorkerPlan());
+				_plans.back().worker = _tasks[task]->worker;
+				it = _plans.end() - 1;
+			}
+			it->tasks.push_back(task);
+		}
+
+		_isRunning = true;
+		for (WorkerPlan& plan : _plans)
+		{
+			_contracts.push_back(plan.worker->addExecutionStep([this, &plan]() {
+					_executePlan(plan);
+				}));
+		}
+	}
+
+	void TaskGraph::stop()
+	{
+		if (_isRunning.exchange(false) == false)
+			return;
+
+		for (auto& task : _tasks)
+		{
+			task->completedFrame.fetch_or(CancelledFlag, std::memory_order_release);
+			task->completedFrame.notify_all();
+		}
+
+		_contracts.clear();
+	}
+
+	bool TaskGraph::_waitDependency(const Dependency& p_dependency, uint64_t p_frame)
+	{
+		if (p_frame <= p_dependency.frameLag)
+			return (true);
+
+		uint64_t wantedFrame = p_frame - p_dependency.frameLag;
+		std::atomic<uint64_t>& completedFrame = _tasks[p_dependency.task]->completedFrame;
+		uint64_t value = completedFrame.load(std::memory_order_acquire);
+
+		while ((value & CancelledFlag) == 0 && value < wantedFrame)
+		{
+			completedFrame.wait(value, std::memory_order_acquire);
+			value = completedFrame.load(std::memory_order_acquire);
+		}
+
+		return ((value & CancelledFlag) == 0);
+	}
+
+	void TaskGraph::_executePlan(WorkerPlan& p_plan)
+	{
+		uint64_t frame = ++p_plan.frame;
+
+		for (TaskID taskID : p_plan.tasks)
+		{
+			Task& task = *(_tasks[taskID]);
+
+			for (const Dependency& dependency : task.dependencies)
+			{
+				if (_waitDependency(dependency, frame) == false)
+					return;
+			}
+
+			task.job();
+
+			uint64_t expected = task.completedFrame.load(std::memory_order_relaxed);
+			if ((expected & CancelledFlag) != 0 ||
+				task.completedFrame.compare_exchange_strong(expected, frame, std::memory_order_release, std::memory_order_relaxed) == false)
+				return;
+			task.completedFrame.notify_all();
+		}
+	}
+
+	bool TaskGraph::isRunning() const
+	{
+		return (_isRunning.load());
+	}
+
+	size_t TaskGraph::size() const
+	{
+		return (_tasks.size());
+	}
+
+	const std::wstring& TaskGraph::name(TaskID p_task) const
+	{
+		if (p_task >= _tasks.size())
+			throw std::runtime_error("Unable to access an unknown task.");
+		return (_tasks[p_task]->name);
+	}
+
+	uint64_t TaskGraph::completedFrame(TaskID p_task) const
+	{
+		if (p_task >= _tasks.size())
+			throw std::runtime_error("Unable to access an unknown task.");
+		return (_tasks[p_task]->completedFrame.load(std::memory_order_acquire) & ~CancelledFlag);
+	}
+}
\ No newline at end of file
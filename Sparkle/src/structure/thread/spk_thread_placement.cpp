@@ -0,0 +1,375 @@
+#include "structure/thread/spk_thread_placement.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace spk
+{
+	namespace
+	{
+#ifdef _WIN32
+		constexpr size_t GroupSize = sizeof(KAFFINITY) * 8;
+
+		int windowsPriority(ThreadPlacement::Priority p_priority, ThreadPlacement::Policy p_policy)
+		{
+			if (p_policy == ThreadPlacement::Policy::Idle)
+				return (THREAD_PRIORITY_IDLE);
+			if (p_policy == ThreadPlacement::Policy::RoundRobin || p_policy == ThreadPlacement::Policy::FirstInFirstOut)
+				return (THREAD_PRIORITY_TIME_CRITICAL);
+
+			switch (p_priority)
+			{
+			case ThreadPlacement::Priority::Lowest:
+				return (THREAD_PRIORITY_LOWEST);
+			case ThreadPlacement::Priority::Low:
+				return (THREAD_PRIORITY_BELOW_NORMAL);
+			case ThreadPlacement::Priority::High:
+				return (THREAD_PRIORITY_ABOVE_NORMAL);
+			case ThreadPlacement::Priority::Highest:
+				return (THREAD_PRIORITY_HIGHEST);
+			default:
+				return (THREAD_PRIORITY_NORMAL);
+			}
+		}
+#elif defined(__linux__)
+		size_t readSystemValue(const std::filesystem::path& p_path, size_t p_defaultValue)
+		{
+			std::ifstream file(p_path);
+			size_t result = 0;
+
+			if (file >> result)
+				return (result);
+			return (p_defaultValue);
+		}
+
+		int linuxPolicy(ThreadPlacement::Policy p_policy)
+		{
+			switch (p_policy)
+			{
+			case ThreadPlacement::Policy::Batch:
+				return (SCHED_BATCH);
+			case ThreadPlacement::Policy::Idle:
+				return (SCHED_IDLE);
+			case ThreadPlacement::Policy::RoundRobin:
+				return (SCHED_RR);
+			case ThreadPlacement::Policy::FirstInFirstOut:
+				return (SCHED_FIFO);
+			default:
+				return (SCHED_OTHER);
+			}
+		}
+
+		int linuxNiceValue(ThreadPlacement::Priority p_priority)
+		{
+			switch (p_priority)
+			{
+			case ThreadPlacement::Priority::Lowest:
+				return (19);
+			case ThreadPlacement::Priority::Low:
+				return (10);
+			case ThreadPlacement::Priority::High:
+				return (-10);
+			case ThreadPlacement::Priority::Highest:
+				return (-20);
+			default:
+				return (0);
+			}
+		}
+#endif
+	}
+
+	bool ThreadPlacement::isDefault() const
+	{
+		return (cores.empty() == true && numaNode == AnyNumaNode && priority == Priority::Normal && policy == Policy::Default);
+	}
+
+	std::vector<size_t> ThreadPlacement::allowedCores() const
+	{
+		std::vector<size_t> result = cores;
+
+		if (numaNode != AnyNumaNode)
+		{
+			std::vector<size_t> nodeCores = CpuTopology::local().coresOfNode(static_cast<size_t>(numaNode));
+
+			if (result.empty() == true)
+				result = nodeCores;
+			else
+				std::erase_if(result, [&](size_t p_core) { return (std::find(nodeCores.begin(), nodeCores.end(), p_core) == nodeCores.end()); });
+		}
+
+		return (result);
+	}
+
+	bool ThreadPlacement::applyToCurrentThread() const
+	{
+		if (isDefault() == true)
+			return (true);
+
+		std::vector<size_t> allowed = allowedCores();
+		if (allowed.empty() == true && (cores.empty() == false || numaNode != AnyNumaNode))
+			return (false);
+
+		bool result = true;
+
+#ifdef _WIN32
+		if (allowed.empty() == false)
+		{
+			GROUP_AFFINITY affinity = {};
+			affinity.Group = static_cast<WORD>(allowed[0] / GroupSize);
+			for (size_t core : allowed)
+			{
+				if (core / GroupSize == affinity.Group)
+					affinity.Mask |= static_cast<KAFFINITY>(1) << (core % GroupSize);
+			}
+
+			if (SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) == FALSE)
+				result = false;
+		}
+
+		if (SetThreadPriority(GetCurrentThread(), windowsPriority(priority, policy)) == FALSE)
+			result = false;
+#elif defined(__linux__)
+		if (allowed.empty() == false)
+		{
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			for (size_t core : allowed)
+			{
+				if (core < CPU_SETSIZE)
+					CPU_SET(core, &set);
+			}
+
+			if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+				result = false;
+		}
+
+		int schedulingPolicy = linuxPolicy(policy);
+		if (schedulingPolicy == SCHED_RR || schedulingPolicy == SCHED_FIFO)
+		{
+			int minPriority = sched_get_priority_min(schedulingPolicy);
+			int maxPriority = sched_get_priority_max(schedulingPolicy);
+			sched_param parameter = {};
+			parameter.sched_priority = minPriority + (maxPriority - minPriority) * static_cast<int>(priority) / static_cast<int>(Priority::Highest);
+
+			if (pthread_setschedparam(pthread_self(), schedulingPolicy, &parameter) != 0)
+				result = false;
+		}
+		else
+		{
+			if (policy != Policy::Default)
+			{
+				sched_param parameter = {};
+				if (pthread_setschedparam(pthread_self(), schedulingPolicy, &parameter) != 0)
+					result = false;
+			}
+
+			// Linux only exposes per-thread priority for the time-sharing policies through the nice value of the thread id
+			if (priority != Priority::Normal && setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), linuxNiceValue(priority)) != 0)
+				result = false;
+		}
+#else
+		result = false;
+#endif
+
+		return (result);
+	}
+
+	CpuTopology::CpuTopology(const std::vector<LogicalCore>& p_logicalCores) :
+		_logicalCores(p_logicalCores)
+	{
+		if (_logicalCores.empty() == true)
+		{
+			size_t nbCore = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+			for (size_t i = 0; i < nbCore; i++)
+				_logicalCores.push_back(LogicalCore{ i, i, 0 });
+		}
+
+		std::set<size_t> physicalCores;
+		std::set<size_t> numaNodes;
+		for (const LogicalCore& core : _logicalCores)
+		{
+			physicalCores.insert(core.physicalCore);
+			numaNodes.insert(core.numaNode);
+		}
+		_nbPhysicalCore = physicalCores.size();
+		_nbNumaNode = numaNodes.size();
+	}
+
+	std::vector<CpuTopology::LogicalCore> CpuTopology::_detectLogicalCores()
+	{
+		std::vector<LogicalCore> result;
+
+#ifdef _WIN32
+		DWORD length = 0;
+		GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+		std::vector<std::byte> buffer(length);
+		if (length == 0 || GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &length) == FALSE)
+			return (result);
+
+		std::vector<std::pair<size_t, GROUP_AFFINITY>> nodes;
+		size_t nbPhysicalCore = 0;
+		for (DWORD offset = 0; offset < length;)
+		{
+			const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* information = reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+
+			if (information->Relationship == RelationProcessorCore)
+			{
+				for (WORD i = 0; i < information->Processor.GroupCount; i++)
+				{
+					const GROUP_AFFINITY& affinity = information->Processor.GroupMask[i];
+					for (size_t bit = 0; bit < GroupSize; bit++)
+					{
+						if ((affinity.Mask & (static_cast<KAFFINITY>(1) << bit)) != 0)
+							result.push_back(LogicalCore{ affinity.Group * GroupSize + bit, nbPhysicalCore, 0 });
+					}
+				}
+				nbPhysicalCore++;
+			}
+			else if (information->Relationship == RelationNumaNode)
+			{
+				nodes.emplace_back(information->NumaNode.NodeNumber, information->NumaNode.GroupMask);
+			}
+
+			offset += information->Size;
+		}
+
+		for (LogicalCore& core : result)
+		{
+			for (const auto& [node, affinity] : nodes)
+			{
+				if (core.id / GroupSize == affinity.Group && (affinity.Mask & (static_cast<KAFFINITY>(1) << (core.id % GroupSize))) != 0)
+					core.numaNode = node;
+			}
+		}
+#elif defined(__linux__)
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		if (sched_getaffinity(getpid(), sizeof(set), &set) != 0)
+			return (result);
+
+		std::map<std::pair<size_t, size_t>, size_t> physicalCores;
+		for (size_t cpu = 0; cpu < CPU_SETSIZE; cpu++)
+		{
+			if (CPU_ISSET(cpu, &set) == 0)
+				continue;
+
+			std::filesystem::path directory = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+			size_t package = readSystemValue(directory / "topology" / "physical_package_id", 0);
+			size_t core = readSystemValue(directory / "topology" / "core_id", cpu);
+			size_t node = 0;
+
+			std::error_code error;
+			for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(directory, error))
+			{
+				std::string name = entry.path().filename().string();
+				if (name.size() > 4 && name.compare(0, 4, "node") == 0 && std::isdigit(static_cast<unsigned char>(name[4])) != 0)
+					node = std::stoul(name.substr(4));
+			}
+
+			size_t physicalCore = physicalCores.try_emplace(std::make_pair(package, core), physicalCores.size()).first->second;
+			result.push_back(LogicalCore{ cpu, physicalCore, node });
+		}
+#endif
+
+		return (result);
+	}
+
+	const CpuTopology& CpuTopology::local()
+	{
+		static const CpuTopology result(_detectLogicalCores());
+		return (result);
+	}
+
+	size_t CpuTopology::currentCore()
+	{
+#ifdef _WIN32
+		PROCESSOR_NUMBER number;
+		GetCurrentProcessorNumberEx(&number);
+		return (number.Group * GroupSize + number.Number);
+#elif defined(__linux__)
+		int core = sched_getcpu();
+		return (core < 0 ? 0 : static_cast<size_t>(core));
+#else
+		return (0);
+#endif
+	}
+
+	const std::vector<CpuTopology::LogicalCore>& CpuTopology::logicalCores() const
+	{
+		return (_logicalCores);
+	}
+
+	size_t CpuTopology::nbLogicalCore() const
+	{
+		return (_logicalCores.size());
+	}
+
+	size_t CpuTopology::nbPhysicalCore() const
+	{
+		return (_nbPhysicalCore);
+	}
+
+	size_t CpuTopology::nbNumaNode() const
+	{
+		return (_nbNumaNode);
+	}
+
+	std::vector<size_t> CpuTopology::coresOfNode(size_t p_numaNode) const
+	{
+		std::vector<size_t> result;
+
+		for (const LogicalCore& core : _logicalCores)
+		{
+			if (core.numaNode == p_numaNode)
+				result.push_back(core.id);
+		}
+		return (result);
+	}
+
+	std::vector<size_t> CpuTopology::distribute(size_t p_nbThread) const
+	{
+		std::vector<LogicalCore> ordered = _logicalCores;
+		std::sort(ordered.begin(), ordered.end(), [](const LogicalCore& p_a, const LogicalCore& p_b) {
+				return (std::tie(p_a.numaNode, p_a.physicalCore, p_a.id) < std::tie(p_b.numaNode, p_b.physicalCore, p_b.id));
+			});
+
+		// Every physical core receives a thread before any hyperthread sibling does, filling nodes in order to keep threads close to each other
+		std::vector<std::tuple<size_t, size_t, size_t, size_t>> candidates;
+		size_t siblingIndex = 0;
+		for (size_t i = 0; i < ordered.size(); i++)
+		{
+			if (i != 0 && ordered[i].physicalCore == ordered[i - 1].physicalCore && ordered[i].numaNode == ordered[i - 1].numaNode)
+				siblingIndex++;
+			else
+				siblingIndex = 0;
+			candidates.emplace_back(siblingIndex, ordered[i].numaNode, ordered[i].physicalCore, ordered[i].id);
+		}
+		std::sort(candidates.begin(), candidates.end());
+
+		std::vector<size_t> result;
+		for (size_t i = 0; i < candidates.size() && i < p_nbThread; i++)
+			result.push_back(std::get<3>(candidates[i]));
+		return (result);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+
+namespace spk::Benchmark
+{
+	inline double measure(const std::function<void()>& p_job, size_t p_nbIteration = 1)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < p_nbIteration; i++)
+		{
+			p_job();
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		return (std::chrono::duration<double, std::milli>(end - start).count() / static_cast<double>(p_nbIteration));
+	}
+
+	inline void report(const std::string& p_name, double p_referenceDuration, double p_optimizedDuration)
+	{
+		std::cout << "[ BENCH    ] " << p_name << " : reference " << p_referenceDuration << " ms, optimized " << p_optimizedDuration << " ms";
+		if (p_optimizedDuration > 0)
+			std::cout << " (x" << p_referenceDuration / p_optimizedDuration << ")";
+		std::cout << std::endl;
+	}
+
+	inline void reportThroughput(const std::string& p_name, size_t p_nbByte, double p_duration)
+	{
+		std::cout << "[ BENCH    ] " << p_name << " : " << p_duration << " ms";
+		if (p_duration > 0)
+			std::cout << " (" << (static_cast<double>(p_nbByte) / (1024.0 * 1024.0)) / (p_duration / 1000.0) << " MB/s)";
+		std::cout << std::endl;
+	}
+
+	inline void reportRatio(const std::string& p_name, size_t p_referenceSize, size_t p_optimizedSize)
+	{
+		std::cout << "[ BENCH    ] " << p_name << " : reference " << p_referenceSize << " bytes, optimized " << p_optimizedSize << " bytes";
+		if (p_optimizedSize > 0)
+			std::cout << " (x" << static_cast<double>(p_referenceSize) / static_cast<double>(p_optimizedSize) << ")";
+		std::cout << std::endl;
+	}
+}
\ No newline at end of file
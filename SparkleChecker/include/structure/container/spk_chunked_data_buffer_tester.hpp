@@ -0,0 +1,12 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "structure/container/spk_chunked_data_buffer.hpp"
+
+class ChunkedDataBufferTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t ChunkSize = 16;
+
+    spk::ChunkedDataBuffer buffer{ ChunkSize };
+};
\ No newline at end of file
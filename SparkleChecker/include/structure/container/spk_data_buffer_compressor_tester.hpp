@@ -0,0 +1,29 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "structure/container/spk_data_buffer_compressor.hpp"
+
+class DataBufferCompressorTest : public ::testing::Test
+{
+protected:
+    spk::DataBuffer buffer;
+
+    void fillRepetitive(size_t p_size)
+    {
+        for (size_t i = 0; i < p_size / sizeof(uint32_t); i++)
+            buffer << static_cast<uint32_t>(i % 97);
+    }
+
+    void fillNoise(size_t p_size)
+    {
+        uint32_t state = 0x12345678;
+        for (size_t i = 0; i < p_size; i++)
+        {
+            state = state * 1664525u + 1013904223u;
+            buffer << static_cast<uint8_t>(state >> 24);
+        }
+    }
+};
\ No newline at end of file
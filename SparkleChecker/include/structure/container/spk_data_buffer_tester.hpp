@@ -3,6 +3,9 @@
 #include "structure/container/spk_data_buffer.hpp"
 
 #include <gtest/gtest.h>
+#include <array>
+#include <list>
+#include <limits>
 #include "structure/container/spk_data_buffer.hpp"
 
 class DataBufferTest : public ::testing::Test
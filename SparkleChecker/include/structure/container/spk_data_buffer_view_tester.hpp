@@ -0,0 +1,16 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "structure/container/spk_data_buffer.hpp"
+#include "structure/container/spk_data_buffer_view.hpp"
+
+class DataBufferViewTest : public ::testing::Test
+{
+protected:
+    spk::DataBuffer buffer;
+
+    void SetUp() override
+    {
+        buffer << static_cast<int32_t>(42) << std::vector<float>{ 1.0f, 2.0f, 3.0f } << std::string("Sparkle");
+    }
+};
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "gtest/gtest.h"
+
+#include "structure/container/spk_flat_hash_map.hpp"
+
+#include <string>
+
+class FlatHashMapTest : public ::testing::Test
+{
+protected:
+    struct CollidingHash
+    {
+        size_t operator()(int p_value) const
+        {
+            return (static_cast<size_t>(p_value % 4));
+        }
+    };
+
+    spk::FlatHashMap<std::string, int> map;
+    spk::FlatHashMap<int, int, CollidingHash> collidingMap;
+};
\ No newline at end of file
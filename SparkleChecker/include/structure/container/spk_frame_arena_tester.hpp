@@ -0,0 +1,15 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "structure/container/spk_frame_arena.hpp"
+
+#include <string>
+#include <vector>
+
+class FrameArenaTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t BlockSize = 1024;
+
+    spk::FrameArena arena{ BlockSize };
+};
\ No newline at end of file
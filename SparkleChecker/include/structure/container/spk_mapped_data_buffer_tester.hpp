@@ -0,0 +1,29 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "structure/container/spk_data_buffer.hpp"
+#include "structure/container/spk_mapped_data_buffer.hpp"
+
+class MappedDataBufferTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path filePath;
+    spk::DataBuffer content;
+
+    void SetUp() override
+    {
+        filePath = std::filesystem::temp_directory_path() / "spk_mapped_data_buffer_test.bin";
+
+        content << static_cast<int32_t>(42) << std::vector<float>{ 1.0f, 2.0f, 3.0f } << std::string("Sparkle");
+
+        std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(content.data()), content.size());
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(filePath);
+    }
+};
\ No newline at end of file
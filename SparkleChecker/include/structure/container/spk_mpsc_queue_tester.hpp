@@ -0,0 +1,15 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "structure/container/spk_mpsc_queue.hpp"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+class MPSCQueueTest : public ::testing::Test
+{
+protected:
+    spk::MPSCQueue<int> queue;
+};
\ No newline at end of file
@@ -4,6 +4,9 @@
 
 #include "structure/container/spk_pool.hpp"
 
+#include <thread>
+#include <vector>
+
 class PoolTest : public ::testing::Test
 {
 protected:
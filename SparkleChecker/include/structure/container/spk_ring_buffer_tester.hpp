@@ -0,0 +1,16 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "structure/container/spk_ring_buffer.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+class RingBufferTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t Capacity = 8;
+
+    spk::RingBuffer<int, Capacity> buffer;
+};
\ No newline at end of file
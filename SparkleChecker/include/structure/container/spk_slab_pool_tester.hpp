@@ -0,0 +1,34 @@
+#pragma once
+
+#include "gtest/gtest.h"
+
+#include "structure/container/spk_slab_pool.hpp"
+
+#include <stdexcept>
+#include <string>
+
+class SlabPoolTest : public ::testing::Test
+{
+protected:
+    struct TestObject
+    {
+        int value;
+        std::string name;
+
+        TestObject() : value(0) {}
+        TestObject(int p_value, const std::string& p_name) : value(p_value), name(p_name) {}
+    };
+
+    struct ThrowingObject
+    {
+        ThrowingObject(bool p_shouldThrow)
+        {
+            if (p_shouldThrow == true)
+                throw std::runtime_error("Construction failure");
+        }
+    };
+
+    using TestPool = spk::SlabPool<TestObject>;
+
+    TestPool pool;
+};
\ No newline at end of file
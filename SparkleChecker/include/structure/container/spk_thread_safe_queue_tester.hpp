@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "structure/container/spk_thread_safe_queue.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+class ThreadSafeQueueTest : public ::testing::Test
+{
+protected:
+    spk::ThreadSafeQueue<int> queue;
+};
\ No newline at end of file
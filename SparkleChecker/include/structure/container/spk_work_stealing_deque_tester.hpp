@@ -0,0 +1,16 @@
+#pragma once
+
+#include "gtest/gtest.h"
+
+#include "structure/container/spk_work_stealing_deque.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+class WorkStealingDequeTest : public ::testing::Test
+{
+protected:
+    spk::WorkStealingDeque<int*> deque;
+    std::vector<int> values = std::vector<int>(1024);
+};
\ No newline at end of file
@@ -6,6 +6,11 @@
 
 #include "structure/design_pattern/spk_contract_provider.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
 class ContractProviderTest : public ::testing::Test
 {
 protected:
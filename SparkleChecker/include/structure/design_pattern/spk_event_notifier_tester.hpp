@@ -1,12 +1,27 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <cstdint>
 
 #include "structure/design_pattern/spk_event_notifier.hpp"
 
 class EventNotifierTest : public ::testing::Test
 {
 protected:
+    enum class TestEvent : int
+    {
+        Negative = -1,
+        First = 0,
+        Second = 1,
+        Distant = 1 << 20
+    };
+
+    enum class ByteEvent : uint8_t
+    {
+        First = 0,
+        Last = 255
+    };
+
     void SetUp() override
     {
         notifier = new spk::EventNotifier<std::string>();
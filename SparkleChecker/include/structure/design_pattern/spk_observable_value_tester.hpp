@@ -1,6 +1,10 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <optional>
+#include <stdexcept>
+#include <thread>
 
 #include "structure/design_pattern/spk_observable_value.hpp"
 
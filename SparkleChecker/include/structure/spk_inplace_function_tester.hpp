@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "structure/spk_inplace_function.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+
+class InplaceFunctionTest : public ::testing::Test
+{
+protected:
+    int callCount = 0;
+};
\ No newline at end of file
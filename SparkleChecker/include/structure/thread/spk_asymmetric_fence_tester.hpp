@@ -0,0 +1,16 @@
+#pragma once
+
+#include "structure/thread/spk_asymmetric_fence.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <barrier>
+#include <thread>
+
+class AsymmetricFenceTest : public ::testing::Test
+{
+protected:
+	static constexpr size_t NbRound = 2000;
+
+	std::atomic<int> hotFlag = 0;
+	std::atomic<int> coldFlag = 0;
+};
\ No newline at end of file
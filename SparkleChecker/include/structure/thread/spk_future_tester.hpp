@@ -0,0 +1,22 @@
+#pragma once
+
+#include "structure/thread/spk_persistant_worker.hpp"
+#include "structure/thread/spk_future.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+class FutureTest : public ::testing::Test
+{
+protected:
+	spk::PersistantWorker updater = spk::PersistantWorker(L"Updater");
+	spk::PersistantWorker renderer = spk::PersistantWorker(L"Renderer");
+
+	void TearDown() override
+	{
+		updater.stop();
+		renderer.stop();
+		updater.join();
+		renderer.join();
+	}
+};
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "structure/thread/spk_job_system.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+class JobSystemTest : public ::testing::Test
+{
+protected:
+	spk::JobSystem jobSystem{ 3 };
+	std::atomic<int> counter = 0;
+};
\ No newline at end of file
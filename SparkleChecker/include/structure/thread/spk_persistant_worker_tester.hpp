@@ -1,9 +1,12 @@
 #pragma once
 
 #include "structure/thread/spk_persistant_worker.hpp"
+#include "structure/design_pattern/spk_observable_value.hpp"
 #include <gtest/gtest.h>
 #include <chrono>
 #include <atomic>
+#include <memory_resource>
+#include <vector>
 
 class PersistantWorkerTest : public ::testing::Test
 {
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "structure/thread/spk_task_graph.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+class TaskGraphTest : public ::testing::Test
+{
+protected:
+	spk::PersistantWorker updater = spk::PersistantWorker(L"Updater");
+	spk::PersistantWorker renderer = spk::PersistantWorker(L"Renderer");
+	spk::TaskGraph graph;
+
+	template <typename TPredicate>
+	void runUntil(TPredicate p_predicate, std::chrono::milliseconds p_timeout = std::chrono::milliseconds(2000))
+	{
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + p_timeout;
+
+		graph.start();
+		updater.start();
+		renderer.start();
+		while (p_predicate() == false && std::chrono::steady_clock::now() < deadline)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		graph.stop();
+		updater.stop();
+		renderer.stop();
+		updater.join();
+		renderer.join();
+	}
+};
\ No newline at end of file
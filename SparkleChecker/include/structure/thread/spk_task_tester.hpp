@@ -0,0 +1,21 @@
+#pragma once
+
+#include "structure/thread/spk_task.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+class TaskTest : public ::testing::Test
+{
+protected:
+	spk::PersistantWorker worker = spk::PersistantWorker(L"Coroutine");
+	std::atomic<uint64_t> frame = 0;
+	spk::PersistantWorker::Contract frameContract = worker.addExecutionStep([this]() { frame++; });
+
+	void TearDown() override
+	{
+		worker.stop();
+		worker.join();
+	}
+};
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "structure/thread/spk_thread.hpp"
+#include "structure/thread/spk_thread_placement.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+
+class ThreadPlacementTest : public ::testing::Test
+{
+protected:
+	// Two NUMA nodes of two physical cores, each with a hyperthread sibling
+	spk::CpuTopology topology = spk::CpuTopology({
+			{ 0, 0, 0 }, { 1, 1, 0 }, { 2, 0, 0 }, { 3, 1, 0 },
+			{ 4, 2, 1 }, { 5, 3, 1 }, { 6, 2, 1 }, { 7, 3, 1 }
+		});
+};
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "structure/thread/spk_timed_step.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+
+class TimedStepTest : public ::testing::Test
+{
+protected:
+	int counter = 0;
+	spk::TimedStep::Job callback = [this]() { counter++; };
+};
\ No newline at end of file
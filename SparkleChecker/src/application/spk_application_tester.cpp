@@ -16,6 +16,16 @@ TEST_F(ApplicationTest, addExecutionStepToSpecificThread)
 	ASSERT_TRUE(contract.isValid()) << "Contract should be valid after adding behavior to specific thread.";
 }
 
+TEST_F(ApplicationTest, addFixedStepForwardsBudget)
+{
+	auto contract = app.addFixedStep(L"Physics", std::chrono::milliseconds(5), callback, std::chrono::milliseconds(1), 2);
+
+	std::shared_ptr<const spk::TimedStep> physics = app.worker(spk::Application::MainThreadName)->timedStep(L"Physics");
+
+	ASSERT_TRUE(physics->isFixed()) << "Step added with a timestep should be fixed.";
+	ASSERT_EQ(physics->statistics().budget, std::chrono::milliseconds(1)) << "Application should forward the budget to the worker.";
+}
+
 TEST_F(ApplicationTest, RunApplication)
 {
 	auto contract = app.addExecutionStep(callback);
@@ -49,4 +59,95 @@ TEST_F(ApplicationTest, QuitApplicationWithError)
 
 	ASSERT_FALSE(app.isRunning()) << "Application should not be running after quit.";
 	ASSERT_EQ(errorReturn, errorCode) << "Application should return the correct error code after quit.";
+}
+
+TEST_F(ApplicationTest, ExecutionStepFansOutToJobSystem)
+{
+	std::atomic<int> nbVisitedIndex = 0;
+
+	auto contract = app.addExecutionStep([&]() {
+		app.jobSystem().parallelFor(0, 1000, [&](size_t) { nbVisitedIndex++; });
+		app.quit(0);
+		});
+
+	int errorReturn = -1;
+	std::thread runThread([this, &errorReturn]() { errorReturn = app.run(); });
+	runThread.join();
+
+	ASSERT_GE(app.jobSystem().nbWorker(), 1) << "Application job system should own at least one worker.";
+	ASSERT_EQ(nbVisitedIndex.load() % 1000, 0) << "Every parallelFor issued from an execution step should complete before returning.";
+	ASSERT_GT(nbVisitedIndex.load(), 0) << "Execution step should have fanned work out to the job system.";
+	ASSERT_EQ(errorReturn, 0) << "Application should return the correct error code after quit.";
+}
+
+TEST_F(ApplicationTest, QuitWakesIdleMainThread)
+{
+	app.worker(spk::Application::MainThreadName)->setRunPolicy(spk::PersistantWorker::RunPolicy::WakeOnWork);
+	auto contract = app.addExecutionStep(callback);
+
+	int errorReturn = -1;
+	std::thread runThread([this, &errorReturn]() { errorReturn = app.run(); });
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+	app.quit(7);
+	runThread.join();
+
+	ASSERT_LE(counter.load(), 2) << "An idle main thread should not iterate without being woken up.";
+	ASSERT_EQ(errorReturn, 7) << "Quitting should wake up an idle main thread.";
+}
+
+TEST_F(ApplicationTest, RunJoinsWorkersBeforeReturning)
+{
+	auto contract = app.addExecutionStep(L"WorkerThread", callback);
+	auto quitContract = app.addExecutionStep([&]() {
+		if (counter.load() > 0)
+			app.quit(0);
+		});
+
+	int errorReturn = -1;
+	std::thread runThread([this, &errorReturn]() { errorReturn = app.run(); });
+	runThread.join();
+
+	ASSERT_EQ(errorReturn, 0) << "Application should return the correct error code after quit.";
+	ASSERT_FALSE(app.worker(L"WorkerThread")->isJoinable()) << "Run should join every worker before returning.";
+}
+
+TEST_F(ApplicationTest, TaskGraphOrdersWorkers)
+{
+	std::atomic<uint64_t> producedFrame = 0;
+	std::atomic<uint64_t> nbRender = 0;
+	std::atomic<int> nbMismatch = 0;
+
+	spk::TaskGraph::TaskID update = app.addGraphTask(L"UpdaterThread", L"Update", [&]() { producedFrame++; });
+	spk::TaskGraph::TaskID render = app.addGraphTask(L"Render", [&]() {
+		if (producedFrame.load() != ++nbRender)
+			nbMismatch++;
+		if (nbRender.load() == 20)
+			app.quit(0);
+		});
+	app.taskGraph().addDependency(render, update);
+	app.taskGraph().addDependency(update, render, 1);
+
+	int errorReturn = -1;
+	std::thread runThread([this, &errorReturn]() { errorReturn = app.run(); });
+	runThread.join();
+
+	ASSERT_GE(nbRender.load(), 20) << "Main thread render task should have run until quit.";
+	ASSERT_EQ(nbMismatch.load(), 0) << "Main thread render should always observe the update of its own frame.";
+	ASSERT_FALSE(app.taskGraph().isRunning()) << "Task graph should be stopped when the application stops.";
+	ASSERT_EQ(errorReturn, 0) << "Application should return the correct error code after quit.";
+}
+TEST_F(ApplicationTest, PlaceWorkersAssignsDistinctCores)
+{
+	spk::CpuTopology topology({ { 0, 0, 0 }, { 1, 1, 0 }, { 2, 2, 0 }, { 3, 0, 0 } });
+
+	app.worker(L"Renderer");
+	app.worker(L"Updater");
+	app.placeWorkers(topology);
+
+	ASSERT_EQ(app.worker(spk::Application::MainThreadName)->placement().cores, std::vector<size_t>({ 0 })) << "Main thread should receive the first core.";
+	ASSERT_EQ(app.worker(L"Renderer")->placement().cores, std::vector<size_t>({ 1 })) << "Workers should be pinned on their own physical core.";
+	ASSERT_EQ(app.worker(L"Updater")->placement().cores, std::vector<size_t>({ 2 })) << "Workers should be pinned on their own physical core.";
+	ASSERT_EQ(app.jobSystem().nbWorker(), 1) << "Job system should only use the cores left by the workers.";
+	ASSERT_THROW(app.placeWorkers(topology), std::runtime_error) << "Workers should not be placed once the job system exists.";
 }
\ No newline at end of file
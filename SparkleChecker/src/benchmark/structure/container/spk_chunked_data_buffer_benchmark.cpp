@@ -0,0 +1,37 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_chunked_data_buffer.hpp"
+#include "structure/container/spk_data_buffer.hpp"
+
+#include <vector>
+
+namespace
+{
+	constexpr size_t BlobSize = 128 * 1024 * 1024;
+	constexpr size_t PieceSize = 4 * 1024;
+}
+
+TEST(ChunkedDataBufferBenchmark, BuildLargeBlob)
+{
+	std::vector<uint8_t> piece(PieceSize, 0x42);
+
+	size_t referenceSize = 0;
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			spk::DataBuffer buffer;
+			for (size_t i = 0; i < BlobSize / PieceSize; i++)
+				buffer.append(piece.data(), piece.size());
+			referenceSize = buffer.size();
+		});
+
+	size_t optimizedSize = 0;
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			spk::ChunkedDataBuffer buffer;
+			for (size_t i = 0; i < BlobSize / PieceSize; i++)
+				buffer.append(piece.data(), piece.size());
+			optimizedSize = buffer.size();
+		});
+
+	spk::Benchmark::report("Build a 128MB blob from 4KB appends", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(optimizedSize, referenceSize) << "Both buffers should contain the same amount of data";
+}
\ No newline at end of file
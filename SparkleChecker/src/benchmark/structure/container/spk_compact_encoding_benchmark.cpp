@@ -0,0 +1,63 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_data_buffer.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct SaveEntry
+	{
+		uint32_t identifier;
+		int32_t positionX;
+		int32_t positionY;
+		uint16_t level;
+		std::string name;
+		std::vector<uint32_t> inventory;
+	};
+
+	std::vector<SaveEntry> createSaveFile()
+	{
+		std::vector<SaveEntry> result(100'000);
+
+		for (size_t i = 0; i < result.size(); i++)
+		{
+			result[i] = { static_cast<uint32_t>(i), static_cast<int32_t>(i % 200) - 100, static_cast<int32_t>(i % 50), static_cast<uint16_t>(i % 99), "Entity", { 1, 2, static_cast<uint32_t>(i % 1000) } };
+		}
+
+		return (result);
+	}
+}
+
+TEST(CompactEncodingBenchmark, SaveFileRoundTrip)
+{
+	std::vector<SaveEntry> entries = createSaveFile();
+
+	spk::DataBuffer rawBuffer;
+	spk::DataBuffer compactBuffer;
+	compactBuffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+
+	double rawDuration = spk::Benchmark::measure([&]() {
+			rawBuffer.clear();
+			rawBuffer << entries;
+			rawBuffer.get<std::vector<SaveEntry>>();
+		});
+
+	double compactDuration = spk::Benchmark::measure([&]() {
+			compactBuffer.clear();
+			compactBuffer << entries;
+			compactBuffer.get<std::vector<SaveEntry>>();
+		});
+
+	spk::Benchmark::report("Round trip of 100k save entries (raw vs compact)", rawDuration, compactDuration);
+	std::cout << "[ BENCH    ] Save file size : raw " << rawBuffer.size() << " bytes, compact " << compactBuffer.size() << " bytes" << std::endl;
+
+	compactBuffer.reset();
+	std::vector<SaveEntry> retrievedEntries = compactBuffer.get<std::vector<SaveEntry>>();
+
+	ASSERT_LT(compactBuffer.size(), rawBuffer.size()) << "Compact encoding should produce a smaller payload";
+	ASSERT_EQ(retrievedEntries.size(), entries.size()) << "Compact round trip should preserve the entry count";
+	ASSERT_EQ(retrievedEntries.back().positionX, entries.back().positionX) << "Compact round trip should preserve signed values";
+	ASSERT_EQ(retrievedEntries.back().inventory, entries.back().inventory) << "Compact round trip should preserve nested containers";
+}
\ No newline at end of file
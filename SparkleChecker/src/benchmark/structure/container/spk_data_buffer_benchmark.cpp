@@ -0,0 +1,83 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_data_buffer.hpp"
+
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbElement = 1'000'000;
+
+	struct Vertex
+	{
+		float x;
+		float y;
+		float z;
+	};
+}
+
+TEST(DataBufferBenchmark, SerializeFloatVector)
+{
+	std::vector<float> values(NbElement, 1.5f);
+
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			spk::DataBuffer buffer;
+			buffer << values.size();
+			for (const float& value : values)
+				buffer << value;
+		});
+
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			spk::DataBuffer buffer;
+			buffer << values;
+		});
+
+	spk::Benchmark::report("DataBuffer << std::vector<float>(1M)", referenceDuration, optimizedDuration);
+}
+
+TEST(DataBufferBenchmark, DeserializeFloatVector)
+{
+	std::vector<float> values(NbElement, 1.5f);
+	spk::DataBuffer buffer;
+	buffer << values;
+
+	std::vector<float> result;
+
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			buffer.reset();
+			result.resize(buffer.get<size_t>());
+			for (float& value : result)
+				buffer >> value;
+		});
+
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			buffer.reset();
+			buffer >> result;
+		});
+
+	spk::Benchmark::report("DataBuffer >> std::vector<float>(1M)", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(result, values) << "Deserialized vector should match the serialized one";
+}
+
+TEST(DataBufferBenchmark, SerializeVertexVector)
+{
+	std::vector<Vertex> vertices(NbElement, Vertex{ 1.0f, 2.0f, 3.0f });
+
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			spk::DataBuffer buffer;
+			buffer << vertices.size();
+			for (const Vertex& vertex : vertices)
+				buffer << vertex;
+		});
+
+	spk::DataBuffer buffer;
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			buffer.clear();
+			buffer << vertices;
+		});
+
+	spk::Benchmark::report("DataBuffer << std::vector<Vertex>(1M)", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(buffer.size(), sizeof(size_t) + NbElement * sizeof(Vertex)) << "Serialized buffer should contain the size and the raw vertices";
+}
\ No newline at end of file
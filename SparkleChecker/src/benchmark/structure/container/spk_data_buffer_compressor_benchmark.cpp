@@ -0,0 +1,79 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_data_buffer_compressor.hpp"
+
+#include <thread>
+
+namespace
+{
+	constexpr size_t BlobSize = 64 * 1024 * 1024;
+
+	struct Vertex
+	{
+		float x;
+		float y;
+		float z;
+		uint32_t color;
+	};
+
+	spk::DataBuffer createBlob()
+	{
+		spk::DataBuffer result;
+		result.reserve(BlobSize);
+
+		uint32_t state = 0x12345678;
+		while (result.size() < BlobSize)
+		{
+			state = state * 1664525u + 1013904223u;
+			Vertex vertex = { static_cast<float>(state % 1024), static_cast<float>((state >> 10) % 16), 0.0f, 0xFF00FF00 };
+			result << vertex;
+		}
+		return (result);
+	}
+}
+
+TEST(DataBufferCompressorBenchmark, CompressionThroughput)
+{
+	spk::DataBuffer blob = createBlob();
+	size_t nbThread = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+	spk::DataBuffer sequential;
+	double sequentialDuration = spk::Benchmark::measure([&]() {
+			sequential = blob.compress();
+		});
+
+	spk::DataBuffer parallel;
+	double parallelDuration = spk::Benchmark::measure([&]() {
+			parallel = blob.compress(nbThread);
+		});
+
+	spk::Benchmark::reportThroughput("Compress a 64MB blob on one thread", blob.size(), sequentialDuration);
+	spk::Benchmark::reportThroughput("Compress a 64MB blob on " + std::to_string(nbThread) + " threads", blob.size(), parallelDuration);
+	spk::Benchmark::report("Block-parallel compression", sequentialDuration, parallelDuration);
+	spk::Benchmark::reportRatio("Compression ratio", blob.size(), parallel.size());
+
+	ASSERT_LT(parallel.size(), blob.size()) << "Serialized vertices should be compressible";
+}
+
+TEST(DataBufferCompressorBenchmark, DecompressionThroughput)
+{
+	spk::DataBuffer blob = createBlob();
+	spk::DataBuffer compressed = blob.compress();
+	size_t nbThread = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+	spk::DataBuffer sequential;
+	double sequentialDuration = spk::Benchmark::measure([&]() {
+			sequential = compressed.decompress();
+		});
+
+	spk::DataBuffer parallel;
+	double parallelDuration = spk::Benchmark::measure([&]() {
+			parallel = compressed.decompress(nbThread);
+		});
+
+	spk::Benchmark::reportThroughput("Decompress a 64MB blob on one thread", blob.size(), sequentialDuration);
+	spk::Benchmark::reportThroughput("Decompress a 64MB blob on " + std::to_string(nbThread) + " threads", blob.size(), parallelDuration);
+
+	ASSERT_EQ(parallel.size(), blob.size()) << "Decompressed blob should match the original size";
+	ASSERT_EQ(std::memcmp(parallel.data(), blob.data(), blob.size()), 0) << "Decompressed blob should match the original data";
+}
\ No newline at end of file
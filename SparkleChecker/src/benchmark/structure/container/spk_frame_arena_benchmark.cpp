@@ -0,0 +1,47 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_frame_arena.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbFrame = 1'000;
+	constexpr size_t NbTemporary = 200;
+}
+
+TEST(FrameArenaBenchmark, TemporaryAllocationsPerFrame)
+{
+	size_t referenceSize = 0;
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			for (size_t frame = 0; frame < NbFrame; frame++)
+			{
+				std::vector<std::string> names;
+				for (size_t i = 0; i < NbTemporary; i++)
+					names.emplace_back("Temporary entity name #" + std::to_string(i));
+				referenceSize += names.size();
+			}
+		});
+
+	spk::FrameArena arena;
+	size_t optimizedSize = 0;
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			for (size_t frame = 0; frame < NbFrame; frame++)
+			{
+				arena.reset();
+				std::pmr::vector<std::pmr::string> names(&arena);
+				for (size_t i = 0; i < NbTemporary; i++)
+				{
+					names.emplace_back("Temporary entity name #");
+					names.back() += std::to_string(i);
+				}
+				optimizedSize += names.size();
+			}
+		});
+
+	spk::Benchmark::report("200 temporary strings per frame over 1000 frames", referenceDuration, optimizedDuration);
+	std::cout << "[ BENCH    ] Frame arena high-water mark : " << arena.highWaterMark() << " bytes in " << arena.nbBlock() << " block(s)" << std::endl;
+
+	ASSERT_EQ(optimizedSize, referenceSize) << "Both loops should build the same amount of strings";
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_data_buffer.hpp"
+#include "structure/container/spk_mapped_data_buffer.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	constexpr size_t FileSize = 64 * 1024 * 1024;
+}
+
+TEST(MappedDataBufferBenchmark, OpenAndReadHeader)
+{
+	std::filesystem::path filePath = std::filesystem::temp_directory_path() / "spk_mapped_data_buffer_benchmark.bin";
+
+	{
+		std::vector<uint8_t> content(FileSize, 0xAB);
+		std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(content.data()), content.size());
+	}
+
+	uint64_t referenceHeader = 0;
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			std::ifstream file(filePath, std::ios::binary);
+			spk::DataBuffer buffer(static_cast<size_t>(std::filesystem::file_size(filePath)));
+			file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+			buffer >> referenceHeader;
+		});
+
+	uint64_t optimizedHeader = 0;
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			spk::MappedDataBuffer buffer(filePath, spk::MappedDataBuffer::AccessPattern::Sequential);
+			buffer >> optimizedHeader;
+		});
+
+	spk::Benchmark::report("Open a 64MB asset and read its header", referenceDuration, optimizedDuration);
+
+	std::filesystem::remove(filePath);
+
+	ASSERT_EQ(optimizedHeader, referenceHeader) << "Mapped buffer should expose the same content as a full read";
+}
\ No newline at end of file
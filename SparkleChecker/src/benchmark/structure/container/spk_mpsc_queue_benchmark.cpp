@@ -0,0 +1,69 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_mpsc_queue.hpp"
+#include "structure/container/spk_thread_safe_queue.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbEventPerProducer = 200'000;
+
+	struct MouseEvent
+	{
+		int x;
+		int y;
+		int button;
+	};
+
+	template <typename TPushJob>
+	void runProducers(size_t p_nbProducer, const TPushJob& p_pushJob)
+	{
+		std::vector<std::thread> producers;
+		for (size_t i = 0; i < p_nbProducer; i++)
+		{
+			producers.emplace_back([&]() {
+					for (size_t j = 0; j < NbEventPerProducer; j++)
+						p_pushJob(MouseEvent{ static_cast<int>(j), static_cast<int>(j), 0 });
+				});
+		}
+		for (std::thread& producer : producers)
+			producer.join();
+	}
+}
+
+TEST(MPSCQueueBenchmark, EventThroughputUnderContention)
+{
+	size_t nbProducer = std::max<size_t>(std::thread::hardware_concurrency() - 1, 2);
+	size_t nbEvent = nbProducer * NbEventPerProducer;
+
+	size_t referenceReceived = 0;
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			spk::ThreadSafeQueue<MouseEvent> queue;
+			std::thread consumer([&]() {
+					for (size_t i = 0; i < nbEvent; i++)
+						referenceReceived += static_cast<size_t>(queue.pop().button + 1);
+				});
+			runProducers(nbProducer, [&](MouseEvent&& p_event) { queue.push(std::move(p_event)); });
+			consumer.join();
+		});
+
+	size_t optimizedReceived = 0;
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			spk::MPSCQueue<MouseEvent> queue;
+			std::thread consumer([&]() {
+					while (optimizedReceived < nbEvent)
+					{
+						if (queue.drain([&](MouseEvent&& p_event) { optimizedReceived += static_cast<size_t>(p_event.button + 1); }) == 0)
+							std::this_thread::yield();
+					}
+				});
+			runProducers(nbProducer, [&](MouseEvent&& p_event) { queue.push(std::move(p_event)); });
+			consumer.join();
+		});
+
+	spk::Benchmark::report("Mouse events from " + std::to_string(nbProducer) + " producers to one consumer", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(optimizedReceived, referenceReceived) << "Both queues should deliver every event";
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_pool.hpp"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbIteration = 200'000;
+	constexpr size_t NbHeldObject = 8;
+
+	struct Particle
+	{
+		float position[3];
+		float velocity[3];
+	};
+
+	class LockedPool
+	{
+	public:
+		using Object = std::unique_ptr<Particle, std::function<void(Particle*)>>;
+
+	private:
+		std::recursive_mutex _mutex;
+		std::deque<std::unique_ptr<Particle>> _preallocatedElements;
+		const std::function<void(Particle*)> _destructorLambda = [&](Particle* p_toReturn) {
+				std::lock_guard<std::recursive_mutex> lock(_mutex);
+				_preallocatedElements.push_back(std::unique_ptr<Particle>(p_toReturn));
+			};
+
+	public:
+		Object obtain()
+		{
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+			if (_preallocatedElements.empty())
+				_preallocatedElements.push_back(std::make_unique<Particle>());
+
+			Object item(_preallocatedElements.front().release(), _destructorLambda);
+			_preallocatedElements.pop_front();
+			return (item);
+		}
+	};
+
+	template <typename TPool>
+	double measureChurn(TPool& p_pool, size_t p_nbThread)
+	{
+		return (spk::Benchmark::measure([&]() {
+				std::vector<std::thread> threads;
+				for (size_t i = 0; i < p_nbThread; i++)
+				{
+					threads.emplace_back([&]() {
+							typename TPool::Object held[NbHeldObject];
+							for (size_t j = 0; j < NbIteration; j++)
+							{
+								held[j % NbHeldObject] = p_pool.obtain();
+								held[j % NbHeldObject]->position[0] = static_cast<float>(j);
+							}
+						});
+				}
+				for (std::thread& thread : threads)
+					thread.join();
+			}));
+	}
+}
+
+TEST(PoolBenchmark, MultiThreadedChurn)
+{
+	size_t maxThread = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+	for (size_t nbThread = 1; nbThread <= maxThread; nbThread *= 2)
+	{
+		LockedPool lockedPool;
+		spk::Pool<Particle> pool;
+
+		double referenceDuration = measureChurn(lockedPool, nbThread);
+		double optimizedDuration = measureChurn(pool, nbThread);
+
+		spk::Benchmark::report("Pool obtain/release churn on " + std::to_string(nbThread) + " thread(s)", referenceDuration, optimizedDuration);
+
+		ASSERT_LE(pool.size(), nbThread * NbHeldObject + nbThread * 2 * spk::Pool<Particle>::BatchSize) << "Released objects should be recycled instead of reallocated";
+	}
+}
\ No newline at end of file
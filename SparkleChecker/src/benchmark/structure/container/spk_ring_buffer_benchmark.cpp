@@ -0,0 +1,71 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_ring_buffer.hpp"
+#include "structure/container/spk_thread_safe_queue.hpp"
+
+#include <array>
+#include <thread>
+
+namespace
+{
+	constexpr size_t NbInput = 2'000'000;
+	constexpr size_t BatchSize = 64;
+
+	struct ControllerInput
+	{
+		int16_t leftX = 0;
+		int16_t leftY = 0;
+		uint32_t buttons = 0;
+	};
+}
+
+TEST(RingBufferBenchmark, SingleProducerSingleConsumer)
+{
+	size_t referenceSum = 0;
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			spk::ThreadSafeQueue<ControllerInput> queue;
+			std::thread consumer([&]() {
+					for (size_t i = 0; i < NbInput; i++)
+						referenceSum += queue.pop().buttons;
+				});
+			for (size_t i = 0; i < NbInput; i++)
+				queue.push(ControllerInput{ 0, 0, static_cast<uint32_t>(i & 1) });
+			consumer.join();
+		});
+
+	size_t optimizedSum = 0;
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			spk::RingBuffer<ControllerInput, 4096> buffer;
+			std::thread consumer([&]() {
+					std::array<ControllerInput, BatchSize> inputs;
+					for (size_t received = 0; received < NbInput;)
+					{
+						buffer.waitForData();
+						size_t count = buffer.popBatch(inputs);
+						for (size_t i = 0; i < count; i++)
+							optimizedSum += inputs[i].buttons;
+						received += count;
+					}
+				});
+
+			std::array<ControllerInput, BatchSize> inputs;
+			for (size_t sent = 0; sent < NbInput;)
+			{
+				size_t count = std::min(BatchSize, NbInput - sent);
+				for (size_t i = 0; i < count; i++)
+					inputs[i] = ControllerInput{ 0, 0, static_cast<uint32_t>((sent + i) & 1) };
+
+				for (size_t pushed = 0; pushed < count;)
+				{
+					buffer.waitForSpace();
+					pushed += buffer.pushBatch(std::span<const ControllerInput>(inputs.data() + pushed, count - pushed));
+				}
+				sent += count;
+			}
+			consumer.join();
+		});
+
+	spk::Benchmark::report("2M controller inputs from one producer to one consumer", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(optimizedSum, referenceSum) << "Both containers should deliver every input";
+}
\ No newline at end of file
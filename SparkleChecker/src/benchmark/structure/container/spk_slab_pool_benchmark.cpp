@@ -0,0 +1,76 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/container/spk_pool.hpp"
+#include "structure/container/spk_slab_pool.hpp"
+
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbEntity = 10'000;
+	constexpr size_t NbFrame = 100;
+
+	struct Entity
+	{
+		float position[3] = { 0, 0, 0 };
+		float velocity[3] = { 1, 1, 1 };
+	};
+}
+
+TEST(SlabPoolBenchmark, FrameChurnAndIteration)
+{
+	spk::Pool<Entity> pool;
+	std::vector<spk::Pool<Entity>::Object> objects;
+	float referenceSum = 0;
+
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			for (size_t frame = 0; frame < NbFrame; frame++)
+			{
+				while (objects.size() < NbEntity)
+					objects.push_back(pool.obtain());
+
+				for (auto& object : objects)
+				{
+					for (size_t i = 0; i < 3; i++)
+						object->position[i] += object->velocity[i];
+				}
+
+				for (size_t i = frame % 4; i < objects.size(); i += 4)
+				{
+					referenceSum += objects[i]->position[0];
+					objects[i] = std::move(objects.back());
+					objects.pop_back();
+				}
+			}
+		});
+
+	spk::SlabPool<Entity> slabPool(NbEntity);
+	std::vector<spk::SlabPool<Entity>::Handle> handles;
+	float optimizedSum = 0;
+
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			for (size_t frame = 0; frame < NbFrame; frame++)
+			{
+				while (handles.size() < NbEntity)
+					handles.push_back(slabPool.obtain());
+
+				for (Entity& entity : slabPool)
+				{
+					for (size_t i = 0; i < 3; i++)
+						entity.position[i] += entity.velocity[i];
+				}
+
+				for (size_t i = frame % 4; i < handles.size(); i += 4)
+				{
+					optimizedSum += slabPool[handles[i]].position[0];
+					slabPool.release(handles[i]);
+					handles[i] = handles.back();
+					handles.pop_back();
+				}
+			}
+		});
+
+	spk::Benchmark::report("10k entities churned and iterated over 100 frames", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(slabPool.size(), handles.size()) << "Every live handle should match a live element";
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/design_pattern/spk_contract_provider.hpp"
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbJob = 8;
+	constexpr size_t NbTrigger = 1'000'000;
+
+	class LockedProvider
+	{
+	private:
+		std::vector<std::shared_ptr<std::function<void()>>> _subscribedJobs;
+		std::recursive_mutex _mutex;
+
+	public:
+		void subscribe(const std::function<void()>& p_job)
+		{
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
+			_subscribedJobs.push_back(std::make_shared<std::function<void()>>(p_job));
+		}
+
+		void trigger()
+		{
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
+			for (auto& job : _subscribedJobs)
+			{
+				if (job != nullptr)
+					(*job)();
+			}
+		}
+	};
+}
+
+TEST(ContractProviderBenchmark, TriggerExecutionSteps)
+{
+	size_t referenceCount = 0;
+	LockedProvider lockedProvider;
+	for (size_t i = 0; i < NbJob; i++)
+		lockedProvider.subscribe([&]() { referenceCount++; });
+
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbTrigger; i++)
+				lockedProvider.trigger();
+		});
+
+	size_t optimizedCount = 0;
+	spk::ContractProvider provider;
+	std::vector<spk::ContractProvider::Contract> contracts;
+	for (size_t i = 0; i < NbJob; i++)
+		contracts.push_back(provider.subscribe([&]() { optimizedCount++; }));
+
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbTrigger; i++)
+				provider.trigger();
+		});
+
+	spk::Benchmark::report("1M triggers of 8 execution steps", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(optimizedCount, referenceCount) << "Both providers should run every job";
+}
+TEST(ContractProviderBenchmark, BuildJobWithCapture)
+{
+	constexpr size_t NbBuild = 1'000'000;
+	std::array<float, 8> capture = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+	float referenceSum = 0;
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbBuild; i++)
+			{
+				std::shared_ptr<std::function<void()>> job = std::make_shared<std::function<void()>>([&referenceSum, capture]() { referenceSum += capture[7]; });
+				(*job)();
+			}
+		});
+
+	float optimizedSum = 0;
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbBuild; i++)
+			{
+				spk::ContractProvider::Job job = [&optimizedSum, capture]() { optimizedSum += capture[7]; };
+				job();
+			}
+		});
+
+	spk::Benchmark::report("1M jobs with a 40 bytes capture built and called", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(optimizedSum, referenceSum) << "Both jobs should run the same code";
+}
\ No newline at end of file
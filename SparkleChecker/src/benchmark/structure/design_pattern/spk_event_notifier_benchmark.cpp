@@ -0,0 +1,102 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/design_pattern/spk_event_notifier.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbEvent = 512;
+	constexpr size_t NbNotification = 2'000'000;
+
+	enum class BenchmarkEvent
+	{
+		First = 0,
+		Last = NbEvent - 1
+	};
+}
+
+namespace spk
+{
+	template <>
+	struct EventNotifierDenseSize<BenchmarkEvent>
+	{
+		static constexpr size_t value = NbEvent;
+	};
+}
+
+namespace
+{
+	template <typename TType>
+	class MapNotifier
+	{
+	private:
+		std::map<TType, spk::ContractProvider> _eventProviders;
+
+	public:
+		spk::ContractProvider::Contract subscribe(const TType& p_event, const spk::ContractProvider::Job& p_job)
+		{
+			return _eventProviders[p_event].subscribe(p_job);
+		}
+
+		void notifyEvent(const TType& p_event)
+		{
+			auto it = _eventProviders.find(p_event);
+			if (it != _eventProviders.end())
+				it->second.trigger();
+		}
+	};
+
+	template <typename TNotifier, typename TKeyBuilder>
+	double measureNotifications(TNotifier& p_notifier, size_t& p_count, TKeyBuilder&& p_keyBuilder)
+	{
+		std::vector<spk::ContractProvider::Contract> contracts;
+		for (size_t i = 0; i < NbEvent; i++)
+			contracts.push_back(p_notifier.subscribe(p_keyBuilder(i), [&p_count]() { p_count++; }));
+
+		std::vector<decltype(p_keyBuilder(0))> keys;
+		for (size_t i = 0; i < NbNotification; i++)
+			keys.push_back(p_keyBuilder((i * 37) % NbEvent));
+
+		return (spk::Benchmark::measure([&]() {
+				for (const auto& key : keys)
+					p_notifier.notifyEvent(key);
+			}));
+	}
+}
+
+TEST(EventNotifierBenchmark, NotifyEnumEvent)
+{
+	auto keyBuilder = [](size_t p_index) { return (static_cast<BenchmarkEvent>(p_index)); };
+
+	size_t referenceCount = 0;
+	MapNotifier<BenchmarkEvent> referenceNotifier;
+	double referenceDuration = measureNotifications(referenceNotifier, referenceCount, keyBuilder);
+
+	size_t optimizedCount = 0;
+	spk::EventNotifier<BenchmarkEvent> notifier;
+	double optimizedDuration = measureNotifications(notifier, optimizedCount, keyBuilder);
+
+	spk::Benchmark::report("2M notifications over 512 enum events", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(optimizedCount, referenceCount) << "Both notifiers should run every job";
+}
+
+TEST(EventNotifierBenchmark, NotifyStringEvent)
+{
+	auto keyBuilder = [](size_t p_index) { return ("Event_" + std::to_string(p_index)); };
+
+	size_t referenceCount = 0;
+	MapNotifier<std::string> referenceNotifier;
+	double referenceDuration = measureNotifications(referenceNotifier, referenceCount, keyBuilder);
+
+	size_t optimizedCount = 0;
+	spk::EventNotifier<std::string> notifier;
+	double optimizedDuration = measureNotifications(notifier, optimizedCount, keyBuilder);
+
+	spk::Benchmark::report("2M notifications over 512 string events", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(optimizedCount, referenceCount) << "Both notifiers should run every job";
+}
\ No newline at end of file
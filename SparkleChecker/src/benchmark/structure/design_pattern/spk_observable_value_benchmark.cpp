@@ -0,0 +1,68 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/design_pattern/spk_observable_value.hpp"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbValue = 64;
+	constexpr size_t NbWritePerFrame = 8;
+	constexpr size_t NbFrame = 10'000;
+	constexpr size_t NbSubscriber = 4;
+
+	struct Position
+	{
+		float x = 0;
+		float y = 0;
+
+		bool operator ==(const Position& p_other) const = default;
+	};
+
+	double simulateFrames(spk::ObservableValue<Position>::NotificationMode p_mode, size_t& p_nbCallback)
+	{
+		std::vector<std::unique_ptr<spk::ObservableValue<Position>>> values;
+		std::vector<spk::ObservableValue<Position>::Contract> contracts;
+		float accumulator = 0;
+
+		for (size_t i = 0; i < NbValue; i++)
+		{
+			values.push_back(std::make_unique<spk::ObservableValue<Position>>(Position(), p_mode));
+			for (size_t j = 0; j < NbSubscriber; j++)
+			{
+				contracts.push_back(values.back()->subscribe([&](const Position& p_position) {
+						accumulator += std::sqrt(p_position.x * p_position.x + p_position.y * p_position.y);
+						p_nbCallback++;
+					}));
+			}
+		}
+
+		return (spk::Benchmark::measure([&]() {
+				for (size_t frame = 0; frame < NbFrame; frame++)
+				{
+					for (size_t write = 0; write < NbWritePerFrame; write++)
+					{
+						for (size_t i = 0; i < NbValue; i++)
+							values[i]->set(Position{ static_cast<float>(frame + 1), static_cast<float>(write) });
+					}
+					spk::DeferredNotificationQueue::local().flush();
+				}
+			}));
+	}
+}
+
+TEST(ObservableValueBenchmark, DeferredNotificationPerFrame)
+{
+	size_t referenceCallback = 0;
+	double referenceDuration = simulateFrames(spk::ObservableValue<Position>::NotificationMode::Immediate, referenceCallback);
+
+	size_t optimizedCallback = 0;
+	double optimizedDuration = simulateFrames(spk::ObservableValue<Position>::NotificationMode::Deferred, optimizedCallback);
+
+	spk::Benchmark::report("10K frames of 8 writes on 64 observed values", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(referenceCallback, NbFrame * NbWritePerFrame * NbValue * NbSubscriber) << "Immediate values should notify every write";
+	ASSERT_EQ(optimizedCallback, NbFrame * NbValue * NbSubscriber) << "Deferred values should notify once per frame";
+}
\ No newline at end of file
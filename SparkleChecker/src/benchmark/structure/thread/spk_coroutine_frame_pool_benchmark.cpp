@@ -0,0 +1,41 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/thread/spk_coroutine_frame_pool.hpp"
+
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbIteration = 1 << 14;
+	constexpr size_t NbFrameInFlight = 32;
+	constexpr size_t FrameSizes[] = { 96, 200, 360, 720 };
+}
+
+TEST(CoroutineFramePoolBenchmark, AllocateInFlightFrames)
+{
+	std::vector<void*> frames(NbFrameInFlight);
+
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbIteration; i++)
+			{
+				for (size_t j = 0; j < NbFrameInFlight; j++)
+					frames[j] = ::operator new(FrameSizes[j % 4]);
+				for (size_t j = 0; j < NbFrameInFlight; j++)
+					::operator delete(frames[j], FrameSizes[j % 4]);
+			}
+		});
+
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbIteration; i++)
+			{
+				for (size_t j = 0; j < NbFrameInFlight; j++)
+					frames[j] = spk::CoroutineFramePool::allocate(FrameSizes[j % 4]);
+				for (size_t j = 0; j < NbFrameInFlight; j++)
+					spk::CoroutineFramePool::deallocate(frames[j], FrameSizes[j % 4]);
+			}
+		});
+
+	spk::Benchmark::report("512K coroutine frame allocations, 32 in flight", referenceDuration, optimizedDuration);
+
+	ASSERT_GT(optimizedDuration, 0) << "Benchmark should measure a duration";
+}
\ No newline at end of file
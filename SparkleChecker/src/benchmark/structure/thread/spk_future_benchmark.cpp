@@ -0,0 +1,40 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/thread/spk_future.hpp"
+
+#include <future>
+
+namespace
+{
+	constexpr size_t NbIteration = 1 << 16;
+}
+
+TEST(FutureBenchmark, FulfillAndRead)
+{
+	size_t referenceSum = 0;
+	size_t optimizedSum = 0;
+
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbIteration; i++)
+			{
+				std::promise<size_t> promise;
+				std::future<size_t> future = promise.get_future();
+				promise.set_value(i);
+				referenceSum += future.get();
+			}
+		});
+
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbIteration; i++)
+			{
+				spk::Promise<size_t> promise;
+				spk::Future<size_t> future = promise.future();
+				promise.setValue(i);
+				optimizedSum += future.get();
+			}
+		});
+
+	spk::Benchmark::report("64K promise/future round trips", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(referenceSum, optimizedSum) << "Both futures should deliver the same values";
+}
\ No newline at end of file
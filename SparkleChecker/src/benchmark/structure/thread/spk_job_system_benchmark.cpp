@@ -0,0 +1,40 @@
+#include "benchmark/spk_benchmark.hpp"
+
+#include "structure/thread/spk_job_system.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	constexpr size_t NbElement = 1 << 20;
+
+	float heavyComputation(size_t p_index)
+	{
+		float result = static_cast<float>(p_index);
+		for (size_t i = 0; i < 32; i++)
+			result = std::sqrt(result * result + 1.0f);
+		return (result);
+	}
+}
+
+TEST(JobSystemBenchmark, ParallelForComputation)
+{
+	std::vector<float> referenceResult(NbElement);
+	double referenceDuration = spk::Benchmark::measure([&]() {
+			for (size_t i = 0; i < NbElement; i++)
+				referenceResult[i] = heavyComputation(i);
+		});
+
+	spk::JobSystem jobSystem;
+	std::vector<float> optimizedResult(NbElement);
+	double optimizedDuration = spk::Benchmark::measure([&]() {
+			jobSystem.parallelFor(0, NbElement, [&](size_t p_index) {
+					optimizedResult[p_index] = heavyComputation(p_index);
+				});
+		});
+
+	spk::Benchmark::report("1M heavy computations on " + std::to_string(jobSystem.nbWorker() + 1) + " threads", referenceDuration, optimizedDuration);
+
+	ASSERT_EQ(optimizedResult, referenceResult) << "Both loops should compute the same values";
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "spk_reflection.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct EmptyStruct
+    {
+    };
+
+    struct Position
+    {
+        float x;
+        float y;
+    };
+
+    struct SwappedPosition
+    {
+        int32_t x;
+        float y;
+    };
+
+    struct Entity
+    {
+        std::string name;
+        Position position;
+        std::vector<int> inventory;
+    };
+
+    struct WithCArray
+    {
+        int32_t values[3];
+        float weight;
+    };
+
+    struct WithStdArray
+    {
+        std::array<int32_t, 3> values;
+        float weight;
+    };
+
+    struct SeventeenFields
+    {
+        int32_t f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16;
+    };
+
+    struct NonAggregate
+    {
+        NonAggregate() : value(0) {}
+        int value;
+    };
+}
+
+TEST(ReflectionTest, FieldCount)
+{
+    ASSERT_EQ(spk::FieldCount<Position>::value, 2) << "Position should have two fields";
+    ASSERT_EQ(spk::FieldCount<Entity>::value, 3) << "Entity should have three fields";
+}
+
+TEST(ReflectionTest, IsReflectable)
+{
+    ASSERT_TRUE(spk::IsReflectable<Position>::value) << "Aggregate structs should be reflectable";
+    ASSERT_TRUE(spk::IsReflectable<Entity>::value) << "Aggregate structs holding containers should be reflectable";
+    ASSERT_FALSE(spk::IsReflectable<EmptyStruct>::value) << "Empty structs should not be reflectable";
+    ASSERT_FALSE(spk::IsReflectable<NonAggregate>::value) << "Non aggregate classes should not be reflectable";
+    ASSERT_FALSE(spk::IsReflectable<int>::value) << "Scalars should not be reflectable";
+    ASSERT_FALSE(spk::IsReflectable<std::vector<int>>::value) << "Containers should not be reflectable";
+}
+
+TEST(ReflectionTest, UnsupportedAggregates)
+{
+    ASSERT_TRUE(spk::HasCArrayField<WithCArray>::value) << "C array members should be detected";
+    ASSERT_FALSE(spk::HasCArrayField<WithStdArray>::value) << "std::array members should not be mistaken for C arrays";
+    ASSERT_FALSE(spk::HasCArrayField<Entity>::value) << "Aggregates without arrays should not be flagged";
+    ASSERT_TRUE(spk::HasTooManyReflectedFields<SeventeenFields>::value) << "Aggregates above the field limit should be detected";
+    ASSERT_FALSE(spk::HasTooManyReflectedFields<Entity>::value) << "Aggregates below the field limit should not be flagged";
+
+    ASSERT_FALSE(spk::IsReflectable<WithCArray>::value) << "Aggregates holding C arrays should not be reflectable";
+    ASSERT_FALSE(spk::IsReflectable<SeventeenFields>::value) << "Aggregates above the field limit should not be reflectable";
+    ASSERT_TRUE(spk::IsReflectable<WithStdArray>::value) << "Aggregates holding std::array should stay reflectable";
+}
+
+TEST(ReflectionTest, ForEachField)
+{
+    Entity entity{ "Hero", { 1.0f, 2.0f }, { 1, 2, 3 } };
+    size_t nbField = 0;
+
+    spk::forEachField(entity, [&](auto&) { nbField++; });
+    ASSERT_EQ(nbField, 3) << "forEachField should visit every field";
+
+    std::get<1>(spk::toTuple(entity)).x = 42.0f;
+    ASSERT_EQ(entity.position.x, 42.0f) << "toTuple should reference the object fields";
+}
+
+TEST(ReflectionTest, LayoutHash)
+{
+    constexpr uint64_t positionHash = spk::layoutHash<Position>();
+
+    ASSERT_EQ(positionHash, spk::layoutHash<Position>()) << "Layout hash should be stable";
+    ASSERT_NE(positionHash, spk::layoutHash<SwappedPosition>()) << "Layouts with different field types should not share a hash";
+    ASSERT_NE(spk::layoutHash<Entity>(), spk::layoutHash<Position>()) << "Different layouts should not share a hash";
+    ASSERT_NE(spk::layoutHash<std::vector<float>>(), spk::layoutHash<std::vector<int32_t>>()) << "Containers of different types should not share a hash";
+}
\ No newline at end of file
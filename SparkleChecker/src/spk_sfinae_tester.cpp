@@ -7,6 +7,7 @@
 #include <set>
 #include <string>
 #include <memory>
+#include <array>
 
 namespace
 {
@@ -29,4 +30,27 @@ TEST(IsContainerTest, IsContainerFalse)
     ASSERT_FALSE(spk::IsContainer<double>::value) << "double should not be recognized as a container";
     ASSERT_FALSE(spk::IsContainer<char>::value) << "char should not be recognized as a container";
     ASSERT_FALSE(spk::IsContainer<std::unique_ptr<int>>::value) << "std::unique_ptr should not be recognized as a container";
+}
+
+TEST(IsContiguousContainerTest, IsContiguousContainerTrue)
+{
+    ASSERT_TRUE(spk::IsContiguousContainer<std::vector<int>>::value) << "std::vector should be recognized as a contiguous container";
+    ASSERT_TRUE(spk::IsContiguousContainer<std::string>::value) << "std::string should be recognized as a contiguous container";
+    ASSERT_TRUE((spk::IsContiguousContainer<std::array<int, 4>>::value)) << "std::array should be recognized as a contiguous container";
+}
+
+TEST(IsContiguousContainerTest, IsContiguousContainerFalse)
+{
+    ASSERT_FALSE(spk::IsContiguousContainer<std::list<int>>::value) << "std::list should not be recognized as a contiguous container";
+    ASSERT_FALSE(spk::IsContiguousContainer<::TestMap>::value) << "std::map should not be recognized as a contiguous container";
+    ASSERT_FALSE(spk::IsContiguousContainer<std::vector<bool>>::value) << "std::vector<bool> should not be recognized as a contiguous container";
+    ASSERT_FALSE(spk::IsContiguousContainer<int>::value) << "int should not be recognized as a contiguous container";
+}
+
+TEST(IsTriviallySerializableContainerTest, IsTriviallySerializableContainer)
+{
+    ASSERT_TRUE(spk::IsTriviallySerializableContainer<std::vector<float>>::value) << "std::vector<float> should be trivially serializable";
+    ASSERT_TRUE(spk::IsTriviallySerializableContainer<std::string>::value) << "std::string should be trivially serializable";
+    ASSERT_FALSE(spk::IsTriviallySerializableContainer<std::vector<std::string>>::value) << "std::vector<std::string> should not be trivially serializable";
+    ASSERT_FALSE(spk::IsTriviallySerializableContainer<std::list<int>>::value) << "std::list<int> should not be trivially serializable";
 }
\ No newline at end of file
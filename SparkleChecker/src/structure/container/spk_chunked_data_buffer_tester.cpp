@@ -0,0 +1,113 @@
+#include "structure/container/spk_chunked_data_buffer_tester.hpp"
+
+TEST_F(ChunkedDataBufferTest, DefaultConstructor)
+{
+    spk::ChunkedDataBuffer defaultBuffer;
+    ASSERT_EQ(defaultBuffer.chunkSize(), spk::ChunkedDataBuffer::DefaultChunkSize) << "Default chunk size should be used when none is provided";
+    ASSERT_EQ(defaultBuffer.size(), 0) << "Buffer size should be 0 after default construction";
+    ASSERT_EQ(defaultBuffer.nbChunk(), 0) << "No chunk should be allocated after default construction";
+}
+
+TEST_F(ChunkedDataBufferTest, InvalidChunkSize)
+{
+    ASSERT_THROW(spk::ChunkedDataBuffer(0), std::runtime_error) << "Creating a buffer with empty chunks should throw an error";
+}
+
+TEST_F(ChunkedDataBufferTest, AppendAcrossChunks)
+{
+    std::vector<uint8_t> data(40);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(i);
+
+    buffer.append(data.data(), data.size());
+
+    ASSERT_EQ(buffer.size(), data.size()) << "Buffer size should match the appended data size";
+    ASSERT_EQ(buffer.nbChunk(), 3) << "40 bytes should be spread over three 16 bytes chunks";
+
+    std::vector<spk::DataBufferView> chunks = buffer.chunks();
+    ASSERT_EQ(chunks[0].size(), 16) << "First chunk should be full";
+    ASSERT_EQ(chunks[1].size(), 16) << "Second chunk should be full";
+    ASSERT_EQ(chunks[2].size(), 8) << "Last chunk should only expose its used bytes";
+    ASSERT_EQ(chunks[2].data()[0], 32) << "Last chunk should start with the 33rd appended byte";
+}
+
+TEST_F(ChunkedDataBufferTest, AppendNeverMovesExistingChunks)
+{
+    buffer << static_cast<int32_t>(42);
+    const uint8_t* firstChunk = buffer.chunks()[0].data();
+
+    for (int32_t i = 0; i < 1000; i++)
+        buffer << i;
+
+    ASSERT_EQ(buffer.chunks()[0].data(), firstChunk) << "Appending should never reallocate existing chunks";
+}
+
+TEST_F(ChunkedDataBufferTest, InsertAndRetrieve)
+{
+    std::vector<double> doubleVector = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+    buffer << static_cast<int32_t>(42) << doubleVector << std::string("Sparkle chunked buffer");
+
+    int32_t intValue;
+    std::vector<double> retrievedDoubleVector;
+    std::string text;
+
+    buffer >> intValue >> retrievedDoubleVector >> text;
+
+    ASSERT_EQ(intValue, 42) << "Retrieved int value should match the inserted value";
+    ASSERT_EQ(retrievedDoubleVector, doubleVector) << "Retrieved vector spanning several chunks should match the inserted vector";
+    ASSERT_EQ(text, "Sparkle chunked buffer") << "Retrieved string should match the inserted string";
+    ASSERT_TRUE(buffer.empty()) << "Whole buffer should have been consumed";
+}
+
+TEST_F(ChunkedDataBufferTest, SkipResetAndClear)
+{
+    buffer << static_cast<int32_t>(1) << static_cast<int32_t>(2);
+
+    buffer.skip(sizeof(int32_t));
+    ASSERT_EQ(buffer.get<int32_t>(), 2) << "Reading after a skip should start at the skipped offset";
+    ASSERT_THROW(buffer.skip(1), std::runtime_error) << "Skipping more than available bytes should throw an error";
+
+    buffer.reset();
+    ASSERT_EQ(buffer.get<int32_t>(), 1) << "Reading after a reset should restart from the beginning";
+
+    buffer.clear();
+    ASSERT_EQ(buffer.size(), 0) << "Buffer size should be 0 after clearing";
+    ASSERT_EQ(buffer.bookmark(), 0) << "Bookmark should be 0 after clearing";
+    ASSERT_EQ(buffer.nbChunk(), 0) << "Chunks should be released after clearing";
+}
+
+TEST_F(ChunkedDataBufferTest, ExtractionOutOfBound)
+{
+    buffer << static_cast<int16_t>(1);
+
+    ASSERT_THROW(buffer.get<int32_t>(), std::runtime_error) << "Extracting more than available bytes should throw an error";
+}
+
+TEST_F(ChunkedDataBufferTest, Flatten)
+{
+    std::vector<int32_t> intVector(100);
+    for (size_t i = 0; i < intVector.size(); i++)
+        intVector[i] = static_cast<int32_t>(i);
+
+    buffer << intVector;
+
+    spk::DataBuffer flattenBuffer = buffer.flatten();
+    ASSERT_EQ(flattenBuffer.size(), buffer.size()) << "Flatten buffer size should match the chunked buffer size";
+    ASSERT_EQ(flattenBuffer.get<std::vector<int32_t>>(), intVector) << "Flatten buffer should expose the same content";
+}
+
+TEST_F(ChunkedDataBufferTest, CompactEncoding)
+{
+    buffer.setEncoding(spk::ChunkedDataBuffer::Encoding::Compact);
+
+    std::vector<int64_t> values(20, -1);
+    buffer << values;
+
+    ASSERT_EQ(buffer.size(), 1 + values.size()) << "Container size and elements should be compacted";
+
+    spk::DataBuffer flattenBuffer = buffer.flatten();
+    ASSERT_EQ(flattenBuffer.encoding(), spk::DataBuffer::Encoding::Compact) << "Flatten buffer should keep the encoding";
+    ASSERT_EQ(flattenBuffer.get<std::vector<int64_t>>(), values) << "Flatten buffer should decode the compact content";
+    ASSERT_EQ(buffer.get<std::vector<int64_t>>(), values) << "Chunked buffer should decode the compact content";
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include "structure/container/spk_data_buffer_compressor_tester.hpp"
+
+#include <cstring>
+
+TEST_F(DataBufferCompressorTest, EmptyBuffer)
+{
+    spk::DataBuffer compressed = buffer.compress();
+    spk::DataBuffer decompressed = compressed.decompress();
+
+    ASSERT_EQ(decompressed.size(), 0) << "Decompressing an empty buffer should give an empty buffer";
+}
+
+TEST_F(DataBufferCompressorTest, RoundTripSmallBuffer)
+{
+    buffer << static_cast<uint8_t>(1) << static_cast<uint8_t>(2) << static_cast<uint8_t>(3);
+
+    spk::DataBuffer decompressed = buffer.compress().decompress();
+
+    ASSERT_EQ(decompressed.size(), buffer.size()) << "Decompressed size should match the original size";
+    ASSERT_EQ(std::memcmp(decompressed.data(), buffer.data(), buffer.size()), 0) << "Decompressed data should match the original data";
+}
+
+TEST_F(DataBufferCompressorTest, RoundTripRepetitiveData)
+{
+    fillRepetitive(256 * 1024);
+
+    spk::DataBuffer compressed = buffer.compress();
+    spk::DataBuffer decompressed = compressed.decompress();
+
+    ASSERT_LT(compressed.size(), buffer.size() / 4) << "Repetitive data should be compressed efficiently";
+    ASSERT_EQ(decompressed.size(), buffer.size()) << "Decompressed size should match the original size";
+    ASSERT_EQ(std::memcmp(decompressed.data(), buffer.data(), buffer.size()), 0) << "Decompressed data should match the original data";
+}
+
+TEST_F(DataBufferCompressorTest, RoundTripLongRun)
+{
+    for (size_t i = 0; i < 100000; i++)
+        buffer << static_cast<uint8_t>(0xAB);
+
+    spk::DataBuffer compressed = buffer.compress();
+    spk::DataBuffer decompressed = compressed.decompress();
+
+    ASSERT_LT(compressed.size(), 1024) << "A single byte run should collapse into a few overlapping matches";
+    ASSERT_EQ(decompressed.size(), buffer.size()) << "Decompressed size should match the original size";
+    ASSERT_EQ(std::memcmp(decompressed.data(), buffer.data(), buffer.size()), 0) << "Decompressed data should match the original data";
+}
+
+TEST_F(DataBufferCompressorTest, IncompressibleDataIsStored)
+{
+    fillNoise(64 * 1024);
+
+    spk::DataBuffer compressed = buffer.compress();
+    spk::DataBuffer decompressed = compressed.decompress();
+
+    ASSERT_LE(compressed.size(), buffer.size() + 64) << "Incompressible data should only cost the header";
+    ASSERT_EQ(std::memcmp(decompressed.data(), buffer.data(), buffer.size()), 0) << "Decompressed data should match the original data";
+}
+
+TEST_F(DataBufferCompressorTest, MultipleBlocks)
+{
+    fillRepetitive(100 * 1024);
+    fillNoise(10 * 1024);
+
+    spk::DataBuffer compressed = spk::DataBufferCompressor::compress(buffer.view(), 1, 4096);
+    spk::DataBuffer decompressed = spk::DataBufferCompressor::decompress(compressed.view());
+
+    ASSERT_EQ(decompressed.size(), buffer.size()) << "Decompressed size should match the original size";
+    ASSERT_EQ(std::memcmp(decompressed.data(), buffer.data(), buffer.size()), 0) << "Decompressed data should match the original data";
+}
+
+TEST_F(DataBufferCompressorTest, ParallelCompressionMatchesSequential)
+{
+    fillRepetitive(512 * 1024);
+    fillNoise(64 * 1024);
+
+    spk::DataBuffer sequential = spk::DataBufferCompressor::compress(buffer.view(), 1, 16 * 1024);
+    spk::DataBuffer parallel = spk::DataBufferCompressor::compress(buffer.view(), 4, 16 * 1024);
+
+    ASSERT_EQ(parallel.size(), sequential.size()) << "Parallel compression should produce the same output size";
+    ASSERT_EQ(std::memcmp(parallel.data(), sequential.data(), sequential.size()), 0) << "Parallel compression should produce the same output";
+
+    spk::DataBuffer decompressed = spk::DataBufferCompressor::decompress(parallel.view(), 4);
+
+    ASSERT_EQ(decompressed.size(), buffer.size()) << "Decompressed size should match the original size";
+    ASSERT_EQ(std::memcmp(decompressed.data(), buffer.data(), buffer.size()), 0) << "Decompressed data should match the original data";
+}
+
+TEST_F(DataBufferCompressorTest, DecompressKeepsEncoding)
+{
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+    buffer << static_cast<uint32_t>(300);
+
+    spk::DataBuffer decompressed = buffer.compress().decompress();
+
+    ASSERT_EQ(decompressed.encoding(), spk::DataBuffer::Encoding::Compact) << "Decompressed buffer should keep the source encoding";
+    ASSERT_EQ(decompressed.get<uint32_t>(), 300) << "Decompressed buffer should be readable with its encoding";
+}
+
+TEST_F(DataBufferCompressorTest, InvalidBlockSize)
+{
+    ASSERT_THROW(spk::DataBufferCompressor::compress(buffer.view(), 1, 0), std::runtime_error) << "Compressing with an empty block size should throw an error";
+}
+
+TEST_F(DataBufferCompressorTest, InvalidMagic)
+{
+    fillRepetitive(1024);
+
+    ASSERT_THROW(buffer.decompress(), std::runtime_error) << "Decompressing a buffer without header should throw an error";
+}
+
+TEST_F(DataBufferCompressorTest, CorruptedBlock)
+{
+    fillRepetitive(64 * 1024);
+
+    spk::DataBuffer compressed = buffer.compress();
+    compressed.resize(compressed.size() - 16);
+
+    ASSERT_THROW(compressed.decompress(), std::runtime_error) << "Decompressing a truncated buffer should throw an error";
+}
+
+TEST_F(DataBufferCompressorTest, CorruptedBlockInParallel)
+{
+    fillRepetitive(256 * 1024);
+
+    spk::DataBuffer compressed = spk::DataBufferCompressor::compress(buffer.view(), 1, 16 * 1024);
+    for (size_t i = compressed.size() / 2; i < compressed.size() / 2 + 64; i++)
+        compressed.data()[i] = 0xFF;
+
+    ASSERT_THROW(spk::DataBufferCompressor::decompress(compressed.view(), 4), std::runtime_error) << "Errors raised by a worker should be forwarded to the caller";
+}
+
+TEST_F(DataBufferCompressorTest, CorruptedOriginalSize)
+{
+    fillRepetitive(64 * 1024);
+
+    spk::DataBuffer compressed = buffer.compress();
+    compressed.edit(sizeof(uint32_t), std::numeric_limits<uint64_t>::max());
+
+    ASSERT_THROW(compressed.decompress(), std::runtime_error) << "An original size the payload cannot encode should be rejected before allocating";
+}
+
+TEST_F(DataBufferCompressorTest, CorruptedBlockSize)
+{
+    fillRepetitive(64 * 1024);
+
+    spk::DataBuffer compressed = buffer.compress();
+    compressed.edit(sizeof(uint32_t) + sizeof(uint64_t), std::numeric_limits<uint32_t>::max());
+
+    ASSERT_THROW(compressed.decompress(), std::runtime_error) << "A block size above the supported maximum should be rejected";
+    ASSERT_THROW(spk::DataBufferCompressor::compress(buffer.view(), 1, spk::DataBufferCompressor::MaxBlockSize + 1), std::runtime_error) << "Compressing with a block size above the supported maximum should throw an error";
+}
+
+TEST_F(DataBufferCompressorTest, ConcurrentParallelCompressions)
+{
+    fillRepetitive(256 * 1024);
+
+    spk::DataBuffer reference = spk::DataBufferCompressor::compress(buffer.view(), 1, 16 * 1024);
+    std::vector<spk::DataBuffer> results(4);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        threads.emplace_back([&, i]() {
+                for (size_t j = 0; j < 8; j++)
+                    results[i] = spk::DataBufferCompressor::compress(buffer.view(), 4, 16 * 1024);
+            });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (const spk::DataBuffer& result : results)
+    {
+        ASSERT_EQ(result.size(), reference.size()) << "Compressions running at the same time should produce the same output";
+        ASSERT_EQ(std::memcmp(result.data(), reference.data(), reference.size()), 0) << "Compressions running at the same time should produce the same output";
+    }
+}
\ No newline at end of file
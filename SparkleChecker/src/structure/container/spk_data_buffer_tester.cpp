@@ -19,6 +19,21 @@ TEST_F(DataBufferTest, Resize)
     ASSERT_EQ(buffer.size(), 50) << "Buffer size should be 50 after resizing";
 }
 
+TEST_F(DataBufferTest, ResizeForOverwrite)
+{
+    buffer.resize(16);
+    buffer.edit(0, uint64_t(0xFFFFFFFFFFFFFFFF));
+    buffer.resize(8);
+    buffer.resize(16);
+    buffer.skip(8);
+    ASSERT_EQ(buffer.get<uint64_t>(), 0) << "Resize should still zero-fill the new bytes";
+
+    buffer.reset();
+    buffer.resizeForOverwrite(64);
+    ASSERT_EQ(buffer.size(), 64) << "Buffer size should be 64 after resizing for overwrite";
+    ASSERT_EQ(buffer.get<uint64_t>(), 0xFFFFFFFFFFFFFFFF) << "Resizing for overwrite should keep the existing bytes";
+}
+
 TEST_F(DataBufferTest, Skip)
 {
     buffer.resize(100);
@@ -93,4 +108,271 @@ TEST_F(DataBufferTest, EditRawData)
     buffer.edit(0, rawData, strlen(rawData) + 1);
 
     ASSERT_STREQ(reinterpret_cast<const char*>(buffer.data()), rawData) << "Buffer data should match the edited raw data";
+}
+
+TEST_F(DataBufferTest, Reserve)
+{
+    buffer.reserve(128);
+    ASSERT_GE(buffer.capacity(), 128) << "Buffer capacity should be at least 128 after reserving";
+    ASSERT_EQ(buffer.size(), 0) << "Reserving should not change the buffer size";
+}
+
+TEST_F(DataBufferTest, AmortizedGrowth)
+{
+    size_t nbReallocation = 0;
+    size_t previousCapacity = buffer.capacity();
+
+    for (int32_t i = 0; i < 10000; i++)
+    {
+        buffer << i;
+        if (buffer.capacity() != previousCapacity)
+        {
+            nbReallocation++;
+            previousCapacity = buffer.capacity();
+        }
+    }
+
+    ASSERT_LE(nbReallocation, 20) << "Buffer should grow geometrically instead of once per insertion";
+    ASSERT_EQ(buffer.size(), 10000 * sizeof(int32_t)) << "Buffer size should match the inserted data size";
+}
+
+TEST_F(DataBufferTest, InsertAndRetrieveTriviallyCopyableContainer)
+{
+    struct Vertex
+    {
+        float x;
+        float y;
+        float z;
+
+        bool operator==(const Vertex& p_other) const
+        {
+            return (x == p_other.x && y == p_other.y && z == p_other.z);
+        }
+    };
+
+    std::vector<Vertex> vertices = { {0.0f, 1.0f, 2.0f}, {3.0f, 4.0f, 5.0f}, {6.0f, 7.0f, 8.0f} };
+    buffer << vertices;
+
+    ASSERT_EQ(buffer.size(), sizeof(size_t) + vertices.size() * sizeof(Vertex)) << "Container should be written as its size followed by its raw content";
+
+    std::vector<Vertex> retrievedVertices;
+    buffer >> retrievedVertices;
+    ASSERT_EQ(retrievedVertices, vertices) << "Retrieved vertices should match the inserted vertices";
+    ASSERT_TRUE(buffer.empty()) << "Whole buffer should have been consumed";
+}
+
+TEST_F(DataBufferTest, InsertAndRetrieveString)
+{
+    std::string text = "Sparkle";
+    buffer << text;
+
+    std::string retrievedText;
+    buffer >> retrievedText;
+    ASSERT_EQ(retrievedText, text) << "Retrieved string should match the inserted string";
+}
+
+TEST_F(DataBufferTest, InsertAndRetrieveNonContiguousContainer)
+{
+    std::list<int32_t> intList = { 1, 2, 3, 4, 5 };
+    buffer << intList;
+
+    std::list<int32_t> retrievedIntList;
+    buffer >> retrievedIntList;
+    ASSERT_EQ(retrievedIntList, intList) << "Retrieved list should match the inserted list";
+}
+
+TEST_F(DataBufferTest, InsertAndRetrieveNestedContainer)
+{
+    std::vector<std::vector<int32_t>> nestedVector = { {1, 2}, {}, {3, 4, 5} };
+    buffer << nestedVector;
+
+    std::vector<std::vector<int32_t>> retrievedNestedVector;
+    buffer >> retrievedNestedVector;
+    ASSERT_EQ(retrievedNestedVector, nestedVector) << "Retrieved nested vector should match the inserted nested vector";
+}
+
+TEST_F(DataBufferTest, InsertAndRetrieveContainerOfFixedSizeContainer)
+{
+    std::vector<std::array<int32_t, 3>> arrayVector = { {1, 2, 3}, {4, 5, 6} };
+    buffer << arrayVector;
+
+    ASSERT_EQ(buffer.size(), sizeof(size_t) + arrayVector.size() * (sizeof(size_t) + sizeof(std::array<int32_t, 3>))) << "Each inner container should keep its own size prefix";
+
+    std::vector<std::array<int32_t, 3>> retrievedArrayVector;
+    buffer >> retrievedArrayVector;
+    ASSERT_EQ(retrievedArrayVector, arrayVector) << "Retrieved container of arrays should match the inserted one";
+}
+
+TEST_F(DataBufferTest, InsertAndRetrieveEmptyContainer)
+{
+    std::vector<int32_t> emptyVector;
+    buffer << emptyVector;
+
+    std::vector<int32_t> retrievedVector = { 1, 2 };
+    buffer >> retrievedVector;
+    ASSERT_TRUE(retrievedVector.empty()) << "Retrieved vector should be empty after reading an empty container";
+}
+
+TEST_F(DataBufferTest, RetrieveTruncatedContainer)
+{
+    buffer << static_cast<size_t>(1000);
+    buffer << static_cast<int32_t>(1);
+
+    std::vector<int32_t> retrievedIntVector;
+    ASSERT_THROW(buffer >> retrievedIntVector, std::runtime_error) << "Retrieving a container larger than the buffer content should throw an error";
+}
+
+TEST_F(DataBufferTest, InsertAndRetrieveReflectedStruct)
+{
+    struct Position
+    {
+        float x;
+        float y;
+    };
+
+    struct Entity
+    {
+        std::string name;
+        Position position;
+        std::vector<int32_t> inventory;
+        uint8_t level;
+    };
+
+    Entity entity{ "Hero", { 1.0f, 2.0f }, { 10, 20, 30 }, 7 };
+    buffer << entity;
+
+    ASSERT_EQ(buffer.size(), (sizeof(size_t) + 4) + sizeof(Position) + (sizeof(size_t) + 3 * sizeof(int32_t)) + sizeof(uint8_t)) << "Reflected struct should be written field by field without padding";
+
+    Entity retrievedEntity = buffer.get<Entity>();
+    ASSERT_EQ(retrievedEntity.name, entity.name) << "Retrieved name should match the inserted name";
+    ASSERT_EQ(retrievedEntity.position.x, entity.position.x) << "Retrieved position should match the inserted position";
+    ASSERT_EQ(retrievedEntity.position.y, entity.position.y) << "Retrieved position should match the inserted position";
+    ASSERT_EQ(retrievedEntity.inventory, entity.inventory) << "Retrieved inventory should match the inserted inventory";
+    ASSERT_EQ(retrievedEntity.level, entity.level) << "Retrieved level should match the inserted level";
+    ASSERT_TRUE(buffer.empty()) << "Whole buffer should have been consumed";
+}
+
+TEST_F(DataBufferTest, InsertAndRetrieveReflectedStructContainer)
+{
+    struct Item
+    {
+        std::string name;
+        int32_t quantity;
+    };
+
+    std::vector<Item> items = { { "Sword", 1 }, { "Potion", 5 } };
+    buffer << items;
+
+    std::vector<Item> retrievedItems;
+    buffer >> retrievedItems;
+    ASSERT_EQ(retrievedItems.size(), items.size()) << "Retrieved container should have the inserted size";
+    ASSERT_EQ(retrievedItems[1].name, "Potion") << "Retrieved item name should match the inserted one";
+    ASSERT_EQ(retrievedItems[1].quantity, 5) << "Retrieved item quantity should match the inserted one";
+}
+
+TEST_F(DataBufferTest, DefaultEncoding)
+{
+    ASSERT_EQ(buffer.encoding(), spk::DataBuffer::Encoding::Raw) << "Buffer should use the raw encoding by default";
+}
+
+TEST_F(DataBufferTest, CompactUnsignedInteger)
+{
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+
+    buffer << static_cast<uint32_t>(1) << static_cast<uint32_t>(300) << std::numeric_limits<uint64_t>::max();
+
+    ASSERT_EQ(buffer.size(), 1 + 2 + 10) << "Unsigned integers should be written as LEB128 varints";
+    ASSERT_EQ(buffer.get<uint32_t>(), 1) << "Retrieved small value should match the inserted value";
+    ASSERT_EQ(buffer.get<uint32_t>(), 300) << "Retrieved multi-byte value should match the inserted value";
+    ASSERT_EQ(buffer.get<uint64_t>(), std::numeric_limits<uint64_t>::max()) << "Retrieved maximal value should match the inserted value";
+}
+
+TEST_F(DataBufferTest, CompactSignedInteger)
+{
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+
+    buffer << static_cast<int32_t>(-1) << static_cast<int32_t>(63) << static_cast<int16_t>(-64) << std::numeric_limits<int64_t>::min();
+
+    ASSERT_EQ(buffer.size(), 1 + 1 + 1 + 10) << "Small signed integers should be zigzag encoded on a single byte";
+    ASSERT_EQ(buffer.get<int32_t>(), -1) << "Retrieved negative value should match the inserted value";
+    ASSERT_EQ(buffer.get<int32_t>(), 63) << "Retrieved positive value should match the inserted value";
+    ASSERT_EQ(buffer.get<int16_t>(), -64) << "Retrieved short value should match the inserted value";
+    ASSERT_EQ(buffer.get<int64_t>(), std::numeric_limits<int64_t>::min()) << "Retrieved minimal value should match the inserted value";
+}
+
+TEST_F(DataBufferTest, CompactContainer)
+{
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+
+    std::vector<int32_t> intVector = { 1, -2, 3, 1000 };
+    std::vector<float> floatVector = { 1.0f, 2.0f };
+    std::string text = "Sparkle";
+
+    buffer << intVector << floatVector << text;
+
+    ASSERT_EQ(buffer.size(), (1 + 1 + 1 + 1 + 2) + (1 + 2 * sizeof(float)) + (1 + text.size())) << "Container sizes and integer elements should be compacted";
+    ASSERT_EQ(buffer.get<std::vector<int32_t>>(), intVector) << "Retrieved integer vector should match the inserted vector";
+    ASSERT_EQ(buffer.get<std::vector<float>>(), floatVector) << "Retrieved float vector should match the inserted vector";
+    ASSERT_EQ(buffer.get<std::string>(), text) << "Retrieved string should match the inserted string";
+}
+
+TEST_F(DataBufferTest, CompactReflectedStruct)
+{
+    struct Stats
+    {
+        int32_t health;
+        uint64_t experience;
+        float speed;
+    };
+
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+    buffer << Stats{ 100, 5, 1.5f };
+
+    ASSERT_EQ(buffer.size(), 2 + 1 + sizeof(float)) << "Integer fields of a trivially copyable struct should be compacted";
+
+    Stats stats = buffer.get<Stats>();
+    ASSERT_EQ(stats.health, 100) << "Retrieved health should match the inserted value";
+    ASSERT_EQ(stats.experience, 5) << "Retrieved experience should match the inserted value";
+    ASSERT_EQ(stats.speed, 1.5f) << "Retrieved speed should match the inserted value";
+}
+
+TEST_F(DataBufferTest, CompactEncodingPropagatesToView)
+{
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+    buffer << static_cast<uint32_t>(300);
+
+    spk::DataBufferView view = buffer.view();
+    ASSERT_EQ(view.encoding(), spk::DataBuffer::Encoding::Compact) << "View should inherit the buffer encoding";
+    ASSERT_EQ(view.get<uint32_t>(), 300) << "View should decode compact values";
+}
+
+TEST_F(DataBufferTest, CompactMalformedVarint)
+{
+    std::vector<uint8_t> malformed(11, 0xFF);
+    buffer.append(malformed.data(), malformed.size());
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+
+    ASSERT_THROW(buffer.get<uint64_t>(), std::runtime_error) << "Decoding a varint longer than 10 bytes should throw an error";
+}
+
+TEST_F(DataBufferTest, CompactOverflowingVarint)
+{
+    std::vector<uint8_t> overflowing(9, 0xFF);
+    overflowing.push_back(0x02);
+    buffer.append(overflowing.data(), overflowing.size());
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+
+    ASSERT_THROW(buffer.get<uint64_t>(), std::runtime_error) << "Decoding a varint above 64 bits should throw an error";
+}
+
+TEST_F(DataBufferTest, CompactOutOfRangeInteger)
+{
+    buffer.setEncoding(spk::DataBuffer::Encoding::Compact);
+    buffer << static_cast<uint32_t>(70000);
+    buffer << static_cast<int32_t>(-70000);
+    buffer << static_cast<int32_t>(-1200);
+
+    ASSERT_THROW(buffer.get<uint16_t>(), std::runtime_error) << "Decoding an unsigned value too large for the target type should throw an error";
+    ASSERT_THROW(buffer.get<int16_t>(), std::runtime_error) << "Decoding a signed value too small for the target type should throw an error";
+    ASSERT_EQ(buffer.get<int16_t>(), -1200) << "Decoding a value within range should still succeed";
 }
\ No newline at end of file
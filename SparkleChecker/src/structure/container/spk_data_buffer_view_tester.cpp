@@ -0,0 +1,87 @@
+#include "structure/container/spk_data_buffer_view_tester.hpp"
+
+TEST_F(DataBufferViewTest, DefaultConstructor)
+{
+    spk::DataBufferView view;
+    ASSERT_EQ(view.data(), nullptr) << "Default view should not reference any memory";
+    ASSERT_EQ(view.size(), 0) << "View size should be 0 after default construction";
+    ASSERT_EQ(view.bookmark(), 0) << "Bookmark should be 0 after default construction";
+    ASSERT_TRUE(view.empty()) << "Default view should be empty";
+}
+
+TEST_F(DataBufferViewTest, ViewReferencesBufferMemory)
+{
+    spk::DataBufferView view = buffer.view();
+    ASSERT_EQ(view.data(), buffer.data()) << "View should reference the buffer memory without copying it";
+    ASSERT_EQ(view.size(), buffer.size()) << "View size should match the buffer size";
+}
+
+TEST_F(DataBufferViewTest, ExternalMemory)
+{
+    uint8_t rawData[] = { 1, 2, 3, 4 };
+    spk::DataBufferView view(rawData, sizeof(rawData));
+
+    ASSERT_EQ(view.get<uint8_t>(), 1) << "First byte should be read from the external memory";
+    rawData[1] = 42;
+    ASSERT_EQ(view.get<uint8_t>(), 42) << "View should reflect modifications of the external memory";
+}
+
+TEST_F(DataBufferViewTest, TypedExtraction)
+{
+    spk::DataBufferView view = buffer.view();
+
+    int32_t intValue;
+    std::vector<float> floatVector;
+    std::string text;
+
+    view >> intValue >> floatVector >> text;
+
+    ASSERT_EQ(intValue, 42) << "Retrieved int value should match the inserted value";
+    ASSERT_EQ(floatVector, (std::vector<float>{ 1.0f, 2.0f, 3.0f })) << "Retrieved vector should match the inserted vector";
+    ASSERT_EQ(text, "Sparkle") << "Retrieved string should match the inserted string";
+    ASSERT_TRUE(view.empty()) << "Whole view should have been consumed";
+    ASSERT_EQ(buffer.bookmark(), 0) << "Reading through a view should not move the buffer bookmark";
+}
+
+TEST_F(DataBufferViewTest, SkipAndReset)
+{
+    spk::DataBufferView view = buffer.view();
+
+    view.skip(sizeof(int32_t));
+    ASSERT_EQ(view.bookmark(), sizeof(int32_t)) << "Bookmark should move after skipping";
+    ASSERT_THROW(view.skip(view.size()), std::runtime_error) << "Skipping more than available bytes should throw an error";
+
+    view.reset();
+    ASSERT_EQ(view.get<int32_t>(), 42) << "Reading after a reset should restart from the beginning";
+}
+
+TEST_F(DataBufferViewTest, Slice)
+{
+    spk::DataBufferView slice = buffer.slice(sizeof(int32_t), buffer.size() - sizeof(int32_t));
+
+    ASSERT_EQ(slice.data(), buffer.data() + sizeof(int32_t)) << "Slice should reference the buffer memory at the requested offset";
+    ASSERT_EQ(slice.bookmark(), 0) << "Slice should start with its own bookmark";
+
+    std::vector<float> floatVector;
+    slice >> floatVector;
+    ASSERT_EQ(floatVector, (std::vector<float>{ 1.0f, 2.0f, 3.0f })) << "Slice should expose the data starting at its offset";
+
+    spk::DataBufferView subSlice = slice.slice(slice.bookmark(), slice.leftover());
+    ASSERT_EQ(subSlice.get<std::string>(), "Sparkle") << "A slice of a slice should expose the requested sub-range";
+}
+
+TEST_F(DataBufferViewTest, SliceOutOfBound)
+{
+    spk::DataBufferView view = buffer.view();
+
+    ASSERT_THROW(view.slice(0, view.size() + 1), std::runtime_error) << "Slicing past the end should throw an error";
+    ASSERT_THROW(view.slice(view.size() + 1, 0), std::runtime_error) << "Slicing from past the end should throw an error";
+    ASSERT_NO_THROW(view.slice(view.size(), 0)) << "An empty slice at the end should be valid";
+}
+
+TEST_F(DataBufferViewTest, ExtractionOutOfBound)
+{
+    spk::DataBufferView view = buffer.slice(0, 2);
+
+    ASSERT_THROW(view.get<int32_t>(), std::runtime_error) << "Extracting more than available bytes should throw an error";
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "structure/container/spk_flat_hash_map_tester.hpp"
+
+TEST_F(FlatHashMapTest, DefaultConstructor)
+{
+    ASSERT_EQ(map.size(), 0) << "Map size should be 0 after default construction";
+    ASSERT_TRUE(map.empty()) << "Map should be empty after default construction";
+    ASSERT_EQ(map.find("Missing"), nullptr) << "Searching inside an empty map should return nullptr";
+}
+
+TEST_F(FlatHashMapTest, InsertAndFind)
+{
+    map["First"] = 1;
+    map["Second"] = 2;
+
+    ASSERT_EQ(map.size(), 2) << "Map size should be 2 after inserting two keys";
+    ASSERT_NE(map.find("First"), nullptr) << "Inserted key should be found";
+    ASSERT_EQ(*map.find("First"), 1) << "Found value should match the inserted one";
+    ASSERT_EQ(*map.find("Second"), 2) << "Found value should match the inserted one";
+    ASSERT_FALSE(map.contains("Third")) << "Map should not contain a key that was never inserted";
+}
+
+TEST_F(FlatHashMapTest, TryEmplaceKeepsExistingValue)
+{
+    auto [firstValue, firstInserted] = map.tryEmplace("Key", 10);
+    auto [secondValue, secondInserted] = map.tryEmplace("Key", 20);
+
+    ASSERT_TRUE(firstInserted) << "First emplace should insert the key";
+    ASSERT_FALSE(secondInserted) << "Second emplace should find the existing key";
+    ASSERT_EQ(firstValue, secondValue) << "Both emplace should point to the same value";
+    ASSERT_EQ(*secondValue, 10) << "Existing value should not be overwritten by tryEmplace";
+}
+
+TEST_F(FlatHashMapTest, GrowthKeepsEveryElement)
+{
+    spk::FlatHashMap<int, int> intMap;
+
+    for (int i = 0; i < 10000; i++)
+        intMap[i] = i * 2;
+
+    ASSERT_EQ(intMap.size(), 10000) << "Map should hold every inserted key";
+    ASSERT_GE(intMap.capacity(), intMap.size()) << "Capacity should never be smaller than the size";
+    for (int i = 0; i < 10000; i++)
+    {
+        ASSERT_NE(intMap.find(i), nullptr) << "Key " << i << " should still be found after growth";
+        ASSERT_EQ(*intMap.find(i), i * 2) << "Value of key " << i << " should survive growth";
+    }
+}
+
+TEST_F(FlatHashMapTest, EraseWithCollisions)
+{
+    for (int i = 0; i < 32; i++)
+        collidingMap[i] = i;
+
+    for (int i = 0; i < 32; i += 3)
+        ASSERT_TRUE(collidingMap.erase(i)) << "Erasing an existing key should succeed";
+
+    ASSERT_FALSE(collidingMap.erase(0)) << "Erasing a missing key should fail";
+    for (int i = 0; i < 32; i++)
+    {
+        if (i % 3 == 0)
+            ASSERT_FALSE(collidingMap.contains(i)) << "Erased key " << i << " should no longer be found";
+        else
+            ASSERT_EQ(*collidingMap.find(i), i) << "Colliding key " << i << " should still be found after erasing its neighbours";
+    }
+}
+
+TEST_F(FlatHashMapTest, Clear)
+{
+    map["First"] = 1;
+    map.clear();
+
+    ASSERT_TRUE(map.empty()) << "Map should be empty after clear";
+    ASSERT_FALSE(map.contains("First")) << "Cleared key should no longer be found";
+}
\ No newline at end of file
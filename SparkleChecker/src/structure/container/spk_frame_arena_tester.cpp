@@ -0,0 +1,93 @@
+#include "structure/container/spk_frame_arena_tester.hpp"
+
+TEST_F(FrameArenaTest, DefaultConstructor)
+{
+    spk::FrameArena defaultArena;
+
+    ASSERT_EQ(defaultArena.used(), 0) << "Arena should be empty after construction";
+    ASSERT_EQ(defaultArena.capacity(), 0) << "Arena should not allocate any block before the first allocation";
+}
+
+TEST_F(FrameArenaTest, InvalidBlockSize)
+{
+    ASSERT_THROW(spk::FrameArena(0), std::runtime_error) << "Creating an arena with empty blocks should throw an error";
+}
+
+TEST_F(FrameArenaTest, AllocateIsAligned)
+{
+    (void)arena.allocate(1, 1);
+    void* pointer = arena.allocate(sizeof(double), alignof(double));
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(pointer) % alignof(double), 0) << "Allocation should respect the requested alignment";
+    ASSERT_EQ(arena.nbAllocation(), 2) << "Arena should count every allocation of the frame";
+}
+
+TEST_F(FrameArenaTest, AllocationsAreContiguous)
+{
+    uint8_t* first = static_cast<uint8_t*>(arena.allocate(16, 1));
+    uint8_t* second = static_cast<uint8_t*>(arena.allocate(16, 1));
+
+    ASSERT_EQ(second, first + 16) << "Consecutive allocations should be a simple pointer bump";
+    ASSERT_EQ(arena.used(), 32) << "Used size should match the allocated bytes";
+}
+
+TEST_F(FrameArenaTest, ResetReusesMemory)
+{
+    void* first = arena.allocate(64, 8);
+    arena.reset();
+    void* second = arena.allocate(64, 8);
+
+    ASSERT_EQ(first, second) << "Memory should be reused after a reset";
+    ASSERT_EQ(arena.nbReset(), 1) << "Arena should count resets";
+}
+
+TEST_F(FrameArenaTest, HighWaterMark)
+{
+    (void)arena.allocate(512, 1);
+    arena.reset();
+    (void)arena.allocate(128, 1);
+
+    ASSERT_EQ(arena.used(), 128) << "Used size should only cover the current frame";
+    ASSERT_EQ(arena.highWaterMark(), 512) << "High-water mark should keep the biggest frame";
+}
+
+TEST_F(FrameArenaTest, GrowAndConsolidate)
+{
+    (void)arena.allocate(800, 1);
+    (void)arena.allocate(800, 1);
+    (void)arena.allocate(4096, 1);
+
+    ASSERT_EQ(arena.nbBlock(), 3) << "Arena should chain new blocks when the current one is full";
+
+    size_t capacity = arena.capacity();
+    arena.reset();
+
+    ASSERT_EQ(arena.nbBlock(), 1) << "Arena should merge its blocks on reset";
+    ASSERT_EQ(arena.capacity(), capacity) << "Merged block should keep the whole capacity";
+
+    (void)arena.allocate(800, 1);
+    (void)arena.allocate(800, 1);
+    (void)arena.allocate(4096, 1);
+    ASSERT_EQ(arena.nbBlock(), 1) << "A frame of the same size should now fit in one block";
+}
+
+TEST_F(FrameArenaTest, PolymorphicContainers)
+{
+    std::pmr::vector<int> values(&arena);
+    for (int i = 0; i < 100; i++)
+        values.push_back(i);
+
+    std::pmr::string text("A string long enough to skip the small string optimization", &arena);
+
+    ASSERT_EQ(values[99], 99) << "Container using the arena should behave normally";
+    ASSERT_EQ(text.size(), 58) << "String using the arena should behave normally";
+    ASSERT_GT(arena.used(), 100 * sizeof(int)) << "Container memory should come from the arena";
+}
+
+TEST_F(FrameArenaTest, IsEqual)
+{
+    spk::FrameArena other;
+
+    ASSERT_TRUE(arena.is_equal(arena)) << "Arena should be equal to itself";
+    ASSERT_FALSE(arena.is_equal(other)) << "Two arenas should never be equal";
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "structure/container/spk_mapped_data_buffer_tester.hpp"
+
+TEST_F(MappedDataBufferTest, DefaultConstructor)
+{
+    spk::MappedDataBuffer buffer;
+    ASSERT_FALSE(buffer.isOpen()) << "Default mapped buffer should not be open";
+    ASSERT_EQ(buffer.size(), 0) << "Default mapped buffer should be empty";
+}
+
+TEST_F(MappedDataBufferTest, MapFile)
+{
+    spk::MappedDataBuffer buffer(filePath);
+
+    ASSERT_TRUE(buffer.isOpen()) << "Mapped buffer should be open after mapping a file";
+    ASSERT_EQ(buffer.path(), filePath) << "Mapped buffer should remember the mapped file path";
+    ASSERT_EQ(buffer.size(), content.size()) << "Mapped buffer size should match the file size";
+    ASSERT_EQ(std::memcmp(buffer.data(), content.data(), content.size()), 0) << "Mapped buffer should expose the file content";
+}
+
+TEST_F(MappedDataBufferTest, TypedExtraction)
+{
+    spk::MappedDataBuffer buffer(filePath, spk::MappedDataBuffer::AccessPattern::Sequential);
+
+    int32_t intValue;
+    std::vector<float> floatVector;
+
+    buffer >> intValue >> floatVector;
+
+    ASSERT_EQ(intValue, 42) << "Retrieved int value should match the written value";
+    ASSERT_EQ(floatVector, (std::vector<float>{ 1.0f, 2.0f, 3.0f })) << "Retrieved vector should match the written vector";
+    ASSERT_EQ(buffer.get<std::string>(), "Sparkle") << "Retrieved string should match the written string";
+    ASSERT_TRUE(buffer.empty()) << "Whole mapping should have been consumed";
+}
+
+TEST_F(MappedDataBufferTest, SkipAndSlice)
+{
+    spk::MappedDataBuffer buffer(filePath);
+
+    buffer.skip(sizeof(int32_t));
+    ASSERT_EQ(buffer.get<std::vector<float>>(), (std::vector<float>{ 1.0f, 2.0f, 3.0f })) << "Reading after a skip should start at the skipped offset";
+
+    spk::DataBufferView slice = buffer.slice(buffer.bookmark(), buffer.leftover());
+    ASSERT_EQ(slice.get<std::string>(), "Sparkle") << "Slice of a mapping should expose the requested range";
+}
+
+TEST_F(MappedDataBufferTest, Advise)
+{
+    spk::MappedDataBuffer buffer(filePath);
+
+    ASSERT_NO_THROW(buffer.advise(spk::MappedDataBuffer::AccessPattern::WillNeed)) << "Advising the whole mapping should not throw";
+    ASSERT_NO_THROW(buffer.advise(1, 2, spk::MappedDataBuffer::AccessPattern::Random)) << "Advising an unaligned range should not throw";
+    ASSERT_THROW(buffer.advise(0, buffer.size() + 1, spk::MappedDataBuffer::AccessPattern::Normal), std::runtime_error) << "Advising out of the mapping should throw an error";
+}
+
+TEST_F(MappedDataBufferTest, MissingFile)
+{
+    ASSERT_THROW(spk::MappedDataBuffer(filePath.string() + ".missing"), std::runtime_error) << "Mapping a missing file should throw an error";
+}
+
+TEST_F(MappedDataBufferTest, EmptyFile)
+{
+    std::ofstream(filePath, std::ios::binary | std::ios::trunc).close();
+
+    spk::MappedDataBuffer buffer(filePath);
+    ASSERT_TRUE(buffer.isOpen()) << "Mapped buffer should be open even for an empty file";
+    ASSERT_TRUE(buffer.empty()) << "Mapping an empty file should produce an empty buffer";
+}
+
+TEST_F(MappedDataBufferTest, MoveAndClose)
+{
+    spk::MappedDataBuffer buffer(filePath);
+    buffer.skip(sizeof(int32_t));
+
+    spk::MappedDataBuffer movedBuffer(std::move(buffer));
+    ASSERT_FALSE(buffer.isOpen()) << "Moved-from mapped buffer should not be open";
+    ASSERT_EQ(buffer.size(), 0) << "Moved-from mapped buffer should be empty";
+    ASSERT_TRUE(movedBuffer.isOpen()) << "Moved-to mapped buffer should own the mapping";
+    ASSERT_EQ(movedBuffer.bookmark(), sizeof(int32_t)) << "Moved-to mapped buffer should keep the bookmark";
+
+    movedBuffer.close();
+    ASSERT_FALSE(movedBuffer.isOpen()) << "Mapped buffer should not be open after closing";
+    ASSERT_EQ(movedBuffer.size(), 0) << "Mapped buffer should be empty after closing";
+}
\ No newline at end of file
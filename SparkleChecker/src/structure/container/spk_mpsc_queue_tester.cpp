@@ -0,0 +1,94 @@
+#include "structure/container/spk_mpsc_queue_tester.hpp"
+
+TEST_F(MPSCQueueTest, DefaultConstructor)
+{
+    int value;
+
+    ASSERT_TRUE(queue.empty()) << "Queue should be empty after construction";
+    ASSERT_FALSE(queue.tryPop(value)) << "Popping an empty queue should fail";
+}
+
+TEST_F(MPSCQueueTest, PushAndPopInOrder)
+{
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+
+    int value;
+    ASSERT_TRUE(queue.tryPop(value)) << "Popping a filled queue should succeed";
+    ASSERT_EQ(value, 1) << "Queue should be first in, first out";
+    ASSERT_TRUE(queue.tryPop(value)) << "Popping a filled queue should succeed";
+    ASSERT_EQ(value, 2) << "Queue should be first in, first out";
+    ASSERT_TRUE(queue.tryPop(value)) << "Popping a filled queue should succeed";
+    ASSERT_EQ(value, 3) << "Queue should be first in, first out";
+    ASSERT_TRUE(queue.empty()) << "Queue should be empty after popping every element";
+}
+
+TEST_F(MPSCQueueTest, DrainInOrder)
+{
+    for (int i = 0; i < 10; i++)
+        queue.push(i);
+
+    std::vector<int> result;
+    size_t nbDrained = queue.drain([&](int&& p_value) { result.push_back(p_value); });
+
+    ASSERT_EQ(nbDrained, 10) << "Drain should return the amount of consumed elements";
+    ASSERT_EQ(result, std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 })) << "Drain should consume elements in order";
+    ASSERT_TRUE(queue.empty()) << "Queue should be empty after a drain";
+}
+
+TEST_F(MPSCQueueTest, MoveOnlyElements)
+{
+    spk::MPSCQueue<std::unique_ptr<std::string>> moveQueue;
+    moveQueue.push(std::make_unique<std::string>("Event"));
+
+    std::unique_ptr<std::string> value;
+    ASSERT_TRUE(moveQueue.tryPop(value)) << "Popping a filled queue should succeed";
+    ASSERT_EQ(*value, "Event") << "Move-only elements should be moved out of the queue";
+}
+
+TEST_F(MPSCQueueTest, DestructorReleasesPendingElements)
+{
+    std::shared_ptr<int> tracker = std::make_shared<int>(0);
+
+    {
+        spk::MPSCQueue<std::shared_ptr<int>> trackedQueue;
+        trackedQueue.push(tracker);
+        trackedQueue.push(tracker);
+        ASSERT_EQ(tracker.use_count(), 3) << "Queue should hold a copy of each pushed element";
+    }
+
+    ASSERT_EQ(tracker.use_count(), 1) << "Queue destruction should release pending elements";
+}
+
+TEST_F(MPSCQueueTest, MultipleProducers)
+{
+    constexpr int NbProducer = 4;
+    constexpr int NbElementPerProducer = 10000;
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < NbProducer; i++)
+    {
+        producers.emplace_back([&, i]() {
+                for (int j = 0; j < NbElementPerProducer; j++)
+                    queue.push(i * NbElementPerProducer + j);
+            });
+    }
+
+    std::vector<int> lastValue(NbProducer, -1);
+    int nbReceived = 0;
+    while (nbReceived < NbProducer * NbElementPerProducer)
+    {
+        nbReceived += static_cast<int>(queue.drain([&](int&& p_value) {
+                int producer = p_value / NbElementPerProducer;
+                ASSERT_GT(p_value, lastValue[producer]) << "Elements of a single producer should stay in order";
+                lastValue[producer] = p_value;
+            }));
+    }
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    ASSERT_EQ(nbReceived, NbProducer * NbElementPerProducer) << "Every pushed element should be received";
+    ASSERT_TRUE(queue.empty()) << "Queue should be empty after receiving every element";
+}
\ No newline at end of file
@@ -75,4 +75,76 @@ TEST_F(PoolTest, CleanerFunctionality)
 
     auto obj2 = pool.obtain();
     ASSERT_EQ(obj2->value, 0) << "Object value should be 0 after cleaner is applied";
+}
+
+TEST_F(PoolTest, ObjectIsPointerSized)
+{
+    ASSERT_EQ(sizeof(TestPool::Object), sizeof(void*)) << "Pool handle should be as small as a raw pointer";
+}
+
+TEST_F(PoolTest, MoveObject)
+{
+    auto obj1 = pool.obtain();
+    obj1->value = 7;
+
+    TestPool::Object obj2 = std::move(obj1);
+
+    ASSERT_EQ(obj1, nullptr) << "Moved-from object should be null";
+    ASSERT_EQ(obj2->value, 7) << "Moved object should keep its value";
+
+    obj2.reset();
+    ASSERT_EQ(pool.size(), 1) << "Object should return to the pool once released";
+}
+
+TEST_F(PoolTest, RecycleLargeAmountOfObjects)
+{
+    pool.resize(200);
+    ASSERT_EQ(pool.size(), 200) << "Pool size should be 200 after resizing";
+
+    {
+        std::vector<TestPool::Object> objects;
+        for (size_t i = 0; i < 200; i++)
+            objects.push_back(pool.obtain());
+
+        ASSERT_EQ(pool.size(), 0) << "Pool should be empty once every object is obtained";
+    }
+
+    ASSERT_EQ(pool.size(), 200) << "Every object should go back to the pool";
+}
+
+TEST_F(PoolTest, ReleaseFromAnotherThread)
+{
+    std::vector<TestPool::Object> objects;
+    for (size_t i = 0; i < 100; i++)
+        objects.push_back(pool.obtain());
+
+    std::thread releaser([&]() { objects.clear(); });
+    releaser.join();
+
+    ASSERT_EQ(pool.size(), 100) << "Objects released by another thread should still be accounted";
+
+    for (size_t i = 0; i < 100; i++)
+        objects.push_back(pool.obtain());
+
+    ASSERT_EQ(pool.size(), 0) << "Objects released by another thread should be reused";
+}
+
+TEST_F(PoolTest, ConcurrentChurn)
+{
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&]() {
+                for (size_t j = 0; j < 10000; j++)
+                {
+                    auto obj = pool.obtain();
+                    obj->value++;
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    ASSERT_LE(pool.size(), 4 * 2 * TestPool::BatchSize) << "Concurrent churn should recycle objects instead of allocating";
+    ASSERT_GE(pool.size(), 1) << "Released objects should be back in the pool";
 }
\ No newline at end of file
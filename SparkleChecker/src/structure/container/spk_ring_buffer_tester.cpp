@@ -0,0 +1,104 @@
+#include "structure/container/spk_ring_buffer_tester.hpp"
+
+TEST_F(RingBufferTest, DefaultConstructor)
+{
+    int value;
+
+    ASSERT_TRUE(buffer.empty()) << "Buffer should be empty after construction";
+    ASSERT_EQ(buffer.capacity(), Capacity) << "Buffer capacity should match the template argument";
+    ASSERT_FALSE(buffer.tryPop(value)) << "Popping an empty buffer should fail";
+}
+
+TEST_F(RingBufferTest, PushAndPopInOrder)
+{
+    ASSERT_TRUE(buffer.tryPush(1)) << "Pushing into an empty buffer should succeed";
+    ASSERT_TRUE(buffer.tryPush(2)) << "Pushing into a non-full buffer should succeed";
+    ASSERT_EQ(buffer.size(), 2) << "Buffer size should match the amount of pushed elements";
+
+    int value;
+    ASSERT_TRUE(buffer.tryPop(value)) << "Popping a filled buffer should succeed";
+    ASSERT_EQ(value, 1) << "Buffer should be first in, first out";
+    ASSERT_TRUE(buffer.tryPop(value)) << "Popping a filled buffer should succeed";
+    ASSERT_EQ(value, 2) << "Buffer should be first in, first out";
+    ASSERT_TRUE(buffer.empty()) << "Buffer should be empty after popping every element";
+}
+
+TEST_F(RingBufferTest, PushIntoFullBuffer)
+{
+    for (int i = 0; i < static_cast<int>(Capacity); i++)
+        ASSERT_TRUE(buffer.tryPush(i)) << "Pushing into a non-full buffer should succeed";
+
+    ASSERT_FALSE(buffer.tryPush(42)) << "Pushing into a full buffer should fail";
+
+    int value;
+    buffer.tryPop(value);
+    ASSERT_TRUE(buffer.tryPush(42)) << "Pushing should succeed once a slot is released";
+}
+
+TEST_F(RingBufferTest, WrapAround)
+{
+    int value;
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_TRUE(buffer.tryPush(i)) << "Pushing into a non-full buffer should succeed";
+        ASSERT_TRUE(buffer.tryPop(value)) << "Popping a filled buffer should succeed";
+        ASSERT_EQ(value, i) << "Buffer should keep the order across wrap-arounds";
+    }
+}
+
+TEST_F(RingBufferTest, BatchPushAndPop)
+{
+    std::vector<int> input = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    ASSERT_EQ(buffer.pushBatch(input), Capacity) << "Batch push should stop when the buffer is full";
+
+    std::vector<int> output(4);
+    ASSERT_EQ(buffer.popBatch(output), 4) << "Batch pop should fill the whole destination when enough elements are available";
+    ASSERT_EQ(output, std::vector<int>({ 0, 1, 2, 3 })) << "Batch pop should keep the order";
+
+    ASSERT_EQ(buffer.pushBatch(std::span<const int>(input).subspan(Capacity)), 2) << "Batch push should use the released slots";
+
+    output.resize(10);
+    ASSERT_EQ(buffer.popBatch(output), 6) << "Batch pop should stop when the buffer is empty";
+    ASSERT_EQ(std::vector<int>(output.begin(), output.begin() + 6), std::vector<int>({ 4, 5, 6, 7, 8, 9 })) << "Batch pop should keep the order across wrap-arounds";
+}
+
+TEST_F(RingBufferTest, MoveOnlyElements)
+{
+    spk::RingBuffer<std::unique_ptr<int>, 4> moveBuffer;
+    ASSERT_TRUE(moveBuffer.tryPush(std::make_unique<int>(12))) << "Pushing a move-only element should succeed";
+
+    std::unique_ptr<int> value;
+    ASSERT_TRUE(moveBuffer.tryPop(value)) << "Popping a move-only element should succeed";
+    ASSERT_EQ(*value, 12) << "Move-only element should be moved out of the buffer";
+}
+
+TEST_F(RingBufferTest, DestructorReleasesPendingElements)
+{
+    std::shared_ptr<int> tracker = std::make_shared<int>(0);
+
+    {
+        spk::RingBuffer<std::shared_ptr<int>, 4> trackedBuffer;
+        trackedBuffer.tryPush(tracker);
+        trackedBuffer.tryPush(tracker);
+        ASSERT_EQ(tracker.use_count(), 3) << "Buffer should hold a copy of each pushed element";
+    }
+
+    ASSERT_EQ(tracker.use_count(), 1) << "Buffer destruction should release pending elements";
+}
+
+TEST_F(RingBufferTest, BlockingProducerConsumer)
+{
+    constexpr int NbElement = 10000;
+
+    std::thread producer([&]() {
+            for (int i = 0; i < NbElement; i++)
+                buffer.push(i);
+        });
+
+    for (int i = 0; i < NbElement; i++)
+        ASSERT_EQ(buffer.pop(), i) << "Blocking pop should receive every element in order";
+
+    producer.join();
+    ASSERT_TRUE(buffer.empty()) << "Buffer should be empty after receiving every element";
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "structure/container/spk_slab_pool_tester.hpp"
+
+TEST_F(SlabPoolTest, DefaultConstructor)
+{
+    ASSERT_EQ(pool.size(), 0) << "Pool size should be 0 after default construction";
+    ASSERT_TRUE(pool.empty()) << "Pool should be empty after default construction";
+}
+
+TEST_F(SlabPoolTest, ReserveCapacity)
+{
+    TestPool reservedPool(128);
+
+    ASSERT_GE(reservedPool.capacity(), 128) << "Pool capacity should match the requested capacity";
+    ASSERT_EQ(reservedPool.size(), 0) << "Reserving should not create any element";
+}
+
+TEST_F(SlabPoolTest, ObtainAndAccess)
+{
+    TestPool::Handle handle = pool.obtain(42, "Entity");
+
+    ASSERT_EQ(pool.size(), 1) << "Pool size should be 1 after obtaining an element";
+    ASSERT_TRUE(pool.contains(handle)) << "Pool should contain the obtained handle";
+    ASSERT_EQ(pool[handle].value, 42) << "Element should be built from the provided arguments";
+    ASSERT_EQ(pool.get(handle)->name, "Entity") << "Element should be built from the provided arguments";
+}
+
+TEST_F(SlabPoolTest, ReleaseInvalidatesHandle)
+{
+    TestPool::Handle handle = pool.obtain();
+    pool.release(handle);
+
+    ASSERT_EQ(pool.size(), 0) << "Pool size should be 0 after releasing the element";
+    ASSERT_FALSE(pool.contains(handle)) << "Released handle should no longer be valid";
+    ASSERT_EQ(pool.get(handle), nullptr) << "Accessing a released handle should give nullptr";
+    ASSERT_THROW(pool[handle], std::runtime_error) << "Accessing a released handle should throw an error";
+    ASSERT_THROW(pool.release(handle), std::runtime_error) << "Releasing a handle twice should throw an error";
+}
+
+TEST_F(SlabPoolTest, ReusedSlotChangesGeneration)
+{
+    TestPool::Handle first = pool.obtain(1, "First");
+    pool.release(first);
+
+    TestPool::Handle second = pool.obtain(2, "Second");
+
+    ASSERT_EQ(second.index, first.index) << "Released slot should be reused";
+    ASSERT_NE(second.generation, first.generation) << "Reused slot should get a new generation";
+    ASSERT_FALSE(pool.contains(first)) << "Stale handle should not reach the new element";
+    ASSERT_EQ(pool[second].value, 2) << "New handle should reach the new element";
+}
+
+TEST_F(SlabPoolTest, DefaultHandleIsInvalid)
+{
+    pool.obtain();
+
+    ASSERT_FALSE(pool.contains(TestPool::Handle())) << "Default handle should never be valid";
+}
+
+TEST_F(SlabPoolTest, ReleaseKeepsOtherHandlesValid)
+{
+    TestPool::Handle handles[4];
+    for (int i = 0; i < 4; i++)
+        handles[i] = pool.obtain(i, std::to_string(i));
+
+    pool.release(handles[1]);
+
+    ASSERT_EQ(pool.size(), 3) << "Pool size should be 3 after releasing one element";
+    ASSERT_EQ(pool[handles[0]].value, 0) << "Remaining handles should still reach their element";
+    ASSERT_EQ(pool[handles[2]].value, 2) << "Remaining handles should still reach their element";
+    ASSERT_EQ(pool[handles[3]].value, 3) << "Moved element should still be reachable through its handle";
+}
+
+TEST_F(SlabPoolTest, DenseIteration)
+{
+    TestPool::Handle handles[10];
+    for (int i = 0; i < 10; i++)
+        handles[i] = pool.obtain(i, "");
+
+    for (int i = 0; i < 10; i += 2)
+        pool.release(handles[i]);
+
+    int sum = 0;
+    size_t count = 0;
+    for (const TestObject& object : pool)
+    {
+        sum += object.value;
+        count++;
+    }
+
+    ASSERT_EQ(count, 5) << "Iteration should only visit live elements";
+    ASSERT_EQ(sum, 1 + 3 + 5 + 7 + 9) << "Iteration should visit every live element";
+    ASSERT_EQ(&(*pool.begin()), pool.data()) << "Live elements should be stored contiguously";
+}
+
+TEST_F(SlabPoolTest, HandleFromDenseIndex)
+{
+    TestPool::Handle first = pool.obtain(1, "");
+    TestPool::Handle second = pool.obtain(2, "");
+    pool.release(first);
+
+    ASSERT_EQ(pool.handle(0), second) << "Dense index should map back to the element handle";
+    ASSERT_THROW(pool.handle(1), std::runtime_error) << "Dense index out of bound should throw an error";
+}
+
+TEST_F(SlabPoolTest, Clear)
+{
+    TestPool::Handle first = pool.obtain();
+    TestPool::Handle second = pool.obtain();
+
+    pool.clear();
+
+    ASSERT_EQ(pool.size(), 0) << "Pool should be empty after clear";
+    ASSERT_FALSE(pool.contains(first)) << "Handles should be invalidated by clear";
+    ASSERT_FALSE(pool.contains(second)) << "Handles should be invalidated by clear";
+
+    TestPool::Handle third = pool.obtain(3, "");
+    ASSERT_EQ(pool[third].value, 3) << "Pool should be usable after clear";
+}
+
+TEST_F(SlabPoolTest, ThrowingConstructorKeepsPoolUnchanged)
+{
+    spk::SlabPool<ThrowingObject> throwingPool;
+
+    ASSERT_THROW(throwingPool.obtain(true), std::runtime_error) << "Constructor exceptions should reach the caller";
+    ASSERT_EQ(throwingPool.size(), 0) << "A failed obtain should not add an element";
+
+    auto handle = throwingPool.obtain(false);
+    ASSERT_EQ(handle.index, 0) << "A failed obtain should not consume a slot";
+
+    throwingPool.release(handle);
+    ASSERT_THROW(throwingPool.obtain(true), std::runtime_error) << "Constructor exceptions should reach the caller when reusing a slot";
+
+    auto reusedHandle = throwingPool.obtain(false);
+    ASSERT_EQ(reusedHandle.index, 0) << "A failed obtain should leave the free slot available";
+    ASSERT_EQ(throwingPool.size(), 1) << "Only successfully constructed elements should be stored";
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "structure/container/spk_thread_safe_queue_tester.hpp"
+
+TEST_F(ThreadSafeQueueTest, DefaultConstructor)
+{
+    ASSERT_TRUE(queue.empty()) << "Queue should be empty after construction";
+    ASSERT_EQ(queue.size(), 0) << "Queue size should be 0 after construction";
+    ASSERT_FALSE(queue.isClosed()) << "Queue should be open after construction";
+}
+
+TEST_F(ThreadSafeQueueTest, PushAndPop)
+{
+    queue.push(1);
+    queue.push(2);
+
+    ASSERT_EQ(queue.size(), 2) << "Queue size should match the amount of pushed elements";
+    ASSERT_EQ(queue.pop(), 1) << "Queue should be first in, first out";
+    ASSERT_EQ(queue.pop(), 2) << "Queue should be first in, first out";
+    ASSERT_TRUE(queue.empty()) << "Queue should be empty after popping every element";
+}
+
+TEST_F(ThreadSafeQueueTest, PopMovesElements)
+{
+    spk::ThreadSafeQueue<std::unique_ptr<int>> moveQueue;
+    moveQueue.push(std::make_unique<int>(5));
+
+    std::unique_ptr<int> value = moveQueue.pop();
+    ASSERT_EQ(*value, 5) << "Pop should move move-only elements out of the queue";
+}
+
+TEST_F(ThreadSafeQueueTest, TryPop)
+{
+    int value = 0;
+    ASSERT_FALSE(queue.tryPop(value)) << "TryPop on an empty queue should fail without blocking";
+
+    queue.push(3);
+    ASSERT_TRUE(queue.tryPop(value)) << "TryPop on a filled queue should succeed";
+    ASSERT_EQ(value, 3) << "TryPop should give the front element";
+}
+
+TEST_F(ThreadSafeQueueTest, PopForTimeout)
+{
+    int value = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    ASSERT_FALSE(queue.popFor(value, std::chrono::milliseconds(20))) << "PopFor on an empty queue should time out";
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20)) << "PopFor should wait for the whole timeout";
+}
+
+TEST_F(ThreadSafeQueueTest, PopForReceivesElement)
+{
+    std::thread producer([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            queue.push(7);
+        });
+
+    int value = 0;
+    ASSERT_TRUE(queue.popFor(value, std::chrono::seconds(5))) << "PopFor should wake up when an element is pushed";
+    ASSERT_EQ(value, 7) << "PopFor should give the pushed element";
+    producer.join();
+}
+
+TEST_F(ThreadSafeQueueTest, DrainInto)
+{
+    for (int i = 0; i < 5; i++)
+        queue.push(i);
+
+    std::vector<int> result = { -1 };
+    ASSERT_EQ(queue.drainInto(result), 5) << "DrainInto should return the amount of drained elements";
+    ASSERT_EQ(result, std::vector<int>({ -1, 0, 1, 2, 3, 4 })) << "DrainInto should append elements in order";
+    ASSERT_TRUE(queue.empty()) << "Queue should be empty after a drain";
+    ASSERT_EQ(queue.drainInto(result), 0) << "Draining an empty queue should not add anything";
+}
+
+TEST_F(ThreadSafeQueueTest, CloseWakesBlockedConsumer)
+{
+    bool hasThrown = false;
+    std::thread consumer([&]() {
+            try
+            {
+                queue.pop();
+            }
+            catch (const std::runtime_error&)
+            {
+                hasThrown = true;
+            }
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.close();
+    consumer.join();
+
+    ASSERT_TRUE(hasThrown) << "Closing the queue should release blocked consumers";
+    ASSERT_TRUE(queue.isClosed()) << "Queue should be closed after close";
+}
+
+TEST_F(ThreadSafeQueueTest, CloseKeepsPendingElements)
+{
+    queue.push(1);
+    queue.close();
+
+    ASSERT_THROW(queue.push(2), std::runtime_error) << "Pushing into a closed queue should throw an error";
+    ASSERT_EQ(queue.pop(), 1) << "Pending elements should still be poppable after close";
+    ASSERT_THROW(queue.pop(), std::runtime_error) << "Popping a closed and empty queue should throw an error";
+
+    int value = 0;
+    ASSERT_FALSE(queue.popFor(value, std::chrono::seconds(5))) << "PopFor on a closed and empty queue should return immediately";
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "structure/container/spk_work_stealing_deque_tester.hpp"
+
+TEST_F(WorkStealingDequeTest, DefaultConstructor)
+{
+    ASSERT_TRUE(deque.empty()) << "Deque should be empty after construction";
+    ASSERT_FALSE(deque.pop().has_value()) << "Popping an empty deque should fail";
+    ASSERT_FALSE(deque.steal().has_value()) << "Stealing from an empty deque should fail";
+}
+
+TEST_F(WorkStealingDequeTest, PopIsLastInFirstOut)
+{
+    deque.push(&values[0]);
+    deque.push(&values[1]);
+    deque.push(&values[2]);
+
+    ASSERT_EQ(deque.size(), 3) << "Deque should contain every pushed element";
+    ASSERT_EQ(deque.pop().value(), &values[2]) << "Owner should pop the most recently pushed element";
+    ASSERT_EQ(deque.pop().value(), &values[1]) << "Owner should pop the most recently pushed element";
+}
+
+TEST_F(WorkStealingDequeTest, StealIsFirstInFirstOut)
+{
+    deque.push(&values[0]);
+    deque.push(&values[1]);
+    deque.push(&values[2]);
+
+    ASSERT_EQ(deque.steal().value(), &values[0]) << "Thieves should steal the oldest element";
+    ASSERT_EQ(deque.pop().value(), &values[2]) << "Owner should still pop the newest element";
+    ASSERT_EQ(deque.steal().value(), &values[1]) << "Thieves should steal the remaining element";
+    ASSERT_TRUE(deque.empty()) << "Deque should be empty once every element was taken";
+}
+
+TEST_F(WorkStealingDequeTest, GrowthKeepsElements)
+{
+    spk::WorkStealingDeque<int*> smallDeque(2);
+
+    for (int& value : values)
+        smallDeque.push(&value);
+
+    ASSERT_GE(smallDeque.capacity(), values.size()) << "Deque should grow to hold every pushed element";
+    for (size_t i = values.size(); i > 0; i--)
+        ASSERT_EQ(smallDeque.pop().value(), &values[i - 1]) << "Elements should survive growth in order";
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentStealNeverDuplicates)
+{
+    constexpr size_t NbElement = 100000;
+    constexpr size_t NbThief = 3;
+
+    std::vector<int> elements(NbElement);
+    std::vector<std::atomic<int>> taken(NbElement);
+    std::atomic<bool> producing = true;
+    std::vector<std::thread> thieves;
+
+    for (size_t i = 0; i < NbThief; i++)
+    {
+        thieves.emplace_back([&]() {
+                while (producing == true || deque.empty() == false)
+                {
+                    std::optional<int*> element = deque.steal();
+                    if (element.has_value() == true)
+                        taken[element.value() - elements.data()]++;
+                    else
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    for (size_t i = 0; i < NbElement; i++)
+    {
+        deque.push(&elements[i]);
+        if (i % 3 == 0)
+        {
+            std::optional<int*> element = deque.pop();
+            if (element.has_value() == true)
+                taken[element.value() - elements.data()]++;
+        }
+    }
+    producing = false;
+
+    for (std::thread& thief : thieves)
+        thief.join();
+
+    for (size_t i = 0; i < NbElement; i++)
+        ASSERT_EQ(taken[i].load(), 1) << "Element " << i << " should be taken exactly once";
+}
\ No newline at end of file
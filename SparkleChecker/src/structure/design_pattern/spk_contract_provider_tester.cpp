@@ -166,3 +166,189 @@ TEST_F(ContractProviderTest, InvalidateContracts)
     expectedExecutionCount = 2;
     ASSERT_EQ(executionCount, expectedExecutionCount) << "Execution count should still be 2 after triggering the provider after all contracts were invalidated";
 }
+
+
+TEST_F(ContractProviderTest, SubscribeDuringTrigger)
+{
+    std::vector<spk::ContractProvider::Contract> addedContracts;
+    auto contract = provider.subscribe([&]() {
+            if (addedContracts.empty() == true)
+                addedContracts.push_back(provider.subscribe(incrementCountJob));
+        });
+
+    provider.trigger();
+
+    ASSERT_EQ(executionCount, 0) << "A job subscribed during a trigger should only run from the next trigger";
+
+    provider.trigger();
+
+    ASSERT_EQ(executionCount, 1) << "A job subscribed during a trigger should run on the next trigger";
+}
+
+TEST_F(ContractProviderTest, ResignDuringTrigger)
+{
+    spk::ContractProvider::Contract secondContract = provider.subscribe(incrementCountJob);
+    spk::ContractProvider::Contract firstContract = provider.subscribe([&]() {
+            if (secondContract.isValid() == true)
+                secondContract.resign();
+        });
+    spk::ContractProvider::Contract thirdContract = provider.subscribe([&]() {
+            executionCount += 10;
+        });
+
+    provider.trigger();
+    provider.trigger();
+
+    ASSERT_EQ(executionCount, 21) << "A resigned job should not run anymore while other jobs keep running";
+}
+
+TEST_F(ContractProviderTest, ResignOwnContractDuringTrigger)
+{
+    spk::ContractProvider::Contract contract;
+    contract = provider.subscribe([&]() {
+            executionCount++;
+            contract.resign();
+        });
+
+    provider.trigger();
+    provider.trigger();
+
+    ASSERT_EQ(executionCount, 1) << "A job should be able to resign its own contract";
+    ASSERT_FALSE(contract.isValid()) << "Contract should be invalid after resigning from its own job";
+}
+
+TEST_F(ContractProviderTest, ResignWaitsForRunningJobOnAnotherThread)
+{
+    std::atomic<bool> isStarted = false;
+    std::atomic<bool> isFinished = false;
+
+    spk::ContractProvider::Contract contract = provider.subscribe([&]() {
+            isStarted = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            isFinished = true;
+        });
+
+    std::thread triggerer([&]() { provider.trigger(); });
+    while (isStarted.load() == false)
+        std::this_thread::yield();
+
+    contract.resign();
+    bool isFinishedAfterResign = isFinished.load();
+    triggerer.join();
+
+    ASSERT_TRUE(isFinishedAfterResign) << "Resign should return only once the job running on another thread has returned";
+}
+
+TEST_F(ContractProviderTest, ResignNestedInOwnJobDoesNotWait)
+{
+    spk::ContractProvider::Contract contract;
+    spk::ContractProvider nestedProvider;
+    spk::ContractProvider::Contract nestedContract = nestedProvider.subscribe([&]() {
+            if (contract.isValid() == true)
+                contract.resign();
+        });
+    contract = provider.subscribe([&]() {
+            executionCount++;
+            nestedProvider.trigger();
+        });
+
+    provider.trigger();
+    provider.trigger();
+
+    ASSERT_EQ(executionCount, 1) << "A job resigned from a nested trigger on its own thread should not wait for itself";
+}
+
+TEST_F(ContractProviderTest, ConcurrentSubscribeAndTrigger)
+{
+    std::atomic<int> concurrentCount = 0;
+    std::atomic<bool> running = true;
+
+    std::thread triggerer([&]() {
+            while (running == true)
+                provider.trigger();
+        });
+
+    for (int i = 0; i < 1000; i++)
+    {
+        auto contract = provider.subscribe([&]() { concurrentCount++; });
+        if (i % 2 == 0)
+            contract.relinquish();
+    }
+
+    running = false;
+    triggerer.join();
+
+    int countBefore = concurrentCount.load();
+    provider.trigger();
+
+    ASSERT_EQ(concurrentCount.load() - countBefore, 500) << "Only relinquished jobs should remain subscribed";
+}
+
+
+TEST_F(ContractProviderTest, TypedProviderForwardsArguments)
+{
+    spk::TContractProvider<int, const std::string&> typedProvider;
+    int receivedSum = 0;
+    std::string receivedText;
+
+    auto typedContract = typedProvider.subscribe([&](int p_value, const std::string& p_text) {
+            receivedSum += p_value;
+            receivedText = p_text;
+        });
+    auto parameterlessContract = typedProvider.subscribe(incrementCountJob);
+
+    typedProvider.trigger(3, "First");
+    typedProvider.trigger(4, "Second");
+
+    ASSERT_EQ(receivedSum, 7) << "Typed jobs should receive every triggered argument";
+    ASSERT_EQ(receivedText, "Second") << "Typed jobs should receive the last triggered argument";
+    ASSERT_EQ(executionCount, 2) << "Parameterless jobs should still be executed by a typed provider";
+}
+
+TEST_F(ContractProviderTest, TypedProviderPassesReferenceWithoutCopy)
+{
+    struct CopyCounter
+    {
+        int* nbCopy;
+
+        CopyCounter(int* p_nbCopy) : nbCopy(p_nbCopy) {}
+        CopyCounter(const CopyCounter& p_other) : nbCopy(p_other.nbCopy) { (*nbCopy)++; }
+    };
+
+    spk::TContractProvider<const CopyCounter&> typedProvider;
+    int nbCopy = 0;
+    const CopyCounter* receivedAddress = nullptr;
+    CopyCounter payload(&nbCopy);
+
+    auto contract = typedProvider.subscribe([&](const CopyCounter& p_payload) { receivedAddress = &p_payload; });
+
+    typedProvider.trigger(payload);
+
+    ASSERT_EQ(receivedAddress, &payload) << "Reference payloads should reach the job without any intermediate object";
+    ASSERT_EQ(nbCopy, 0) << "Triggering a reference payload should not copy it";
+}
+
+TEST_F(ContractProviderTest, TypedProviderPassesValueWithoutCopy)
+{
+    struct CopyCounter
+    {
+        int* nbCopy;
+
+        CopyCounter(int* p_nbCopy) : nbCopy(p_nbCopy) {}
+        CopyCounter(const CopyCounter& p_other) : nbCopy(p_other.nbCopy) { (*nbCopy)++; }
+    };
+
+    spk::TContractProvider<CopyCounter> typedProvider;
+    int nbCopy = 0;
+    int nbCall = 0;
+    CopyCounter payload(&nbCopy);
+
+    auto firstContract = typedProvider.subscribe([&](const CopyCounter&) { nbCall++; });
+    auto secondContract = typedProvider.subscribe([&](const CopyCounter&) { nbCall++; });
+    auto thirdContract = typedProvider.subscribe([&]() { nbCall++; });
+
+    typedProvider.trigger(payload);
+
+    ASSERT_EQ(nbCall, 3) << "Every subscriber should be called";
+    ASSERT_EQ(nbCopy, 0) << "Value payloads should be shared by every subscriber instead of copied per call";
+}
\ No newline at end of file
@@ -123,4 +123,81 @@ TEST_F(EventNotifierTest, RelinquishJob)
 
     expectedExecutionCount = 1;
     ASSERT_EQ(executionCount, expectedExecutionCount) << "Execution count should be 1 after calling notifyEvent() on the notifier";
+}
+
+TEST_F(EventNotifierTest, NotifyForwardsPayload)
+{
+    spk::EventNotifier<std::string, int, const std::string&> payloadNotifier;
+    int receivedValue = 0;
+    std::string receivedText;
+
+    auto typedContract = payloadNotifier.subscribe("TestEvent", [&](int p_value, const std::string& p_text) {
+            receivedValue = p_value;
+            receivedText = p_text;
+        });
+    auto parameterlessContract = payloadNotifier.subscribe("TestEvent", incrementCountJob);
+
+    payloadNotifier.notifyEvent("TestEvent", 42, "Payload");
+    payloadNotifier.notifyEvent("OtherEvent", 12, "Ignored");
+
+    ASSERT_EQ(receivedValue, 42) << "Typed jobs should receive the notified payload";
+    ASSERT_EQ(receivedText, "Payload") << "Typed jobs should only receive payloads of their own event";
+    ASSERT_EQ(executionCount, 1) << "Parameterless jobs should still be executed by a payload notifier";
+}
+
+TEST_F(EventNotifierTest, EnumEventsUseDenseTable)
+{
+    spk::EventNotifier<TestEvent> enumNotifier;
+
+    ASSERT_TRUE(spk::EventNotifier<TestEvent>::IsDense) << "Enum events should select the dense dispatch table";
+    ASSERT_FALSE(spk::EventNotifier<std::string>::IsDense) << "Non-enum events should select the hashed dispatch table";
+
+    auto firstContract = enumNotifier.subscribe(TestEvent::First, incrementCountJob);
+    auto secondContract = enumNotifier.subscribe(TestEvent::Second, [this]() { executionCount += 10; });
+
+    enumNotifier.notifyEvent(TestEvent::Second);
+
+    ASSERT_EQ(executionCount, 10) << "Only the jobs of the notified enum value should be executed";
+
+    enumNotifier.notifyEvent(TestEvent::First);
+
+    ASSERT_EQ(executionCount, 11) << "Notifying the first enum value should execute its job";
+}
+
+TEST_F(EventNotifierTest, EnumEventsOutsideDenseRange)
+{
+    spk::EventNotifier<TestEvent, int> enumNotifier;
+
+    auto negativeContract = enumNotifier.subscribe(TestEvent::Negative, [this](int p_value) { executionCount += p_value; });
+    auto distantContract = enumNotifier.subscribe(TestEvent::Distant, [this](int p_value) { executionCount += p_value * 100; });
+
+    enumNotifier.notifyEvent(TestEvent::First, 5);
+    ASSERT_EQ(executionCount, 0) << "Notifying an enum value without subscriber should execute nothing";
+
+    enumNotifier.notifyEvent(TestEvent::Negative, 1);
+    enumNotifier.notifyEvent(TestEvent::Distant, 2);
+
+    ASSERT_EQ(executionCount, 201) << "Enum values outside the dense range should be dispatched through the overflow table";
+
+    distantContract.resign();
+    enumNotifier.notifyEvent(TestEvent::Distant, 2);
+
+    ASSERT_EQ(executionCount, 201) << "Resigned overflow contracts should no longer be executed";
+}
+
+TEST_F(EventNotifierTest, ByteEnumEventsAreFullyDense)
+{
+    spk::EventNotifier<ByteEvent, int> byteNotifier;
+
+    ASSERT_EQ(spk::EventNotifier<ByteEvent>::DenseSize, 256) << "A byte sized enum should get a table covering every value";
+    ASSERT_EQ(spk::EventNotifier<TestEvent>::DenseSize, 64) << "Wider enums should get the default dense table";
+    ASSERT_EQ(spk::EventNotifier<std::string>::DenseSize, 0) << "Non-enum events should not get a dense table";
+
+    auto lastContract = byteNotifier.subscribe(ByteEvent::Last, [this](int p_value) { executionCount += p_value; });
+
+    byteNotifier.notifyEvent(ByteEvent::First, 1);
+    ASSERT_EQ(executionCount, 0) << "Notifying an enum value without subscriber should execute nothing";
+
+    byteNotifier.notifyEvent(ByteEvent::Last, 3);
+    ASSERT_EQ(executionCount, 3) << "The last value of a byte sized enum should be dispatched through the dense table";
 }
\ No newline at end of file
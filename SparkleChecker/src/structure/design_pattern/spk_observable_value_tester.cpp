@@ -71,4 +71,160 @@ TEST_F(ObservableValueTest, DestructorResignsContract)
     expectedExecutionCount = 1;
 
     ASSERT_EQ(executionCount, expectedExecutionCount) << "Execution count should remain 1 after setting a new value because the contract was resigned upon destruction";
+}
+
+TEST_F(ObservableValueTest, SubscribeJobReceivesNewValue)
+{
+    int receivedValue = -1;
+    auto contract = value.subscribe([&](const int& p_value) { receivedValue = p_value; });
+
+    value.set(5);
+
+    ASSERT_EQ(receivedValue, 5) << "Typed jobs should receive the new value";
+
+    value = 7;
+
+    ASSERT_EQ(receivedValue, 7) << "Typed jobs should receive the value assigned through operator =";
+}
+
+TEST_F(ObservableValueTest, ImmediateEqualSetStillNotifies)
+{
+    auto contract = value.subscribe(incrementCountJob);
+
+    value.set(3);
+    value.set(3);
+    value = 3;
+
+    ASSERT_EQ(executionCount, 3) << "Immediate sets should notify subscribers even when the value is unchanged";
+}
+
+TEST_F(ObservableValueTest, DeferredEqualSetIsSuppressed)
+{
+    auto contract = value.subscribe(incrementCountJob);
+
+    value.setNotificationMode(spk::ObservableValue<int>::NotificationMode::Deferred);
+    value.set(0);
+
+    ASSERT_FALSE(value.isDirty()) << "A deferred set of the value already held should not request a notification";
+    ASSERT_EQ(spk::DeferredNotificationQueue::local().flush(), 0) << "An unchanged deferred value should not be flushed";
+    ASSERT_EQ(executionCount, 0) << "An unchanged deferred value should not notify subscribers";
+}
+
+TEST_F(ObservableValueTest, DeferredSetsAreCoalesced)
+{
+    int receivedValue = -1;
+    auto contract = value.subscribe([&](const int& p_value) {
+            ++executionCount;
+            receivedValue = p_value;
+        });
+
+    value.setNotificationMode(spk::ObservableValue<int>::NotificationMode::Deferred);
+    for (int i = 1; i <= 100; i++)
+        value.set(i);
+
+    ASSERT_EQ(executionCount, 0) << "Deferred sets should not notify before the flush";
+    ASSERT_TRUE(value.isDirty()) << "Deferred sets should mark the value as dirty";
+
+    size_t nbFlushed = spk::DeferredNotificationQueue::local().flush();
+
+    ASSERT_EQ(nbFlushed, 1) << "A value written many times should be flushed only once";
+    ASSERT_EQ(executionCount, 1) << "Subscribers should be notified once per flush";
+    ASSERT_EQ(receivedValue, 100) << "Subscribers should receive the final value";
+    ASSERT_FALSE(value.isDirty()) << "Flushed value should no longer be dirty";
+    ASSERT_EQ(spk::DeferredNotificationQueue::local().flush(), 0) << "A clean value should not be flushed again";
+}
+
+TEST_F(ObservableValueTest, DestroyedDeferredValueIsNotFlushed)
+{
+    {
+        spk::ObservableValue<int> deferredValue(0, spk::ObservableValue<int>::NotificationMode::Deferred);
+        auto contract = deferredValue.subscribe(incrementCountJob);
+
+        deferredValue.set(1);
+        ASSERT_EQ(spk::DeferredNotificationQueue::local().size(), 1) << "Deferred value should be waiting in the thread queue";
+    }
+
+    ASSERT_EQ(spk::DeferredNotificationQueue::local().flush(), 0) << "A destroyed value should be removed from the thread queue";
+    ASSERT_EQ(executionCount, 0) << "A destroyed value should never notify";
+}
+
+TEST_F(ObservableValueTest, SwitchingToImmediateFlushesPendingValue)
+{
+    auto contract = value.subscribe(incrementCountJob);
+
+    value.setNotificationMode(spk::ObservableValue<int>::NotificationMode::Deferred);
+    value.set(4);
+    value.setNotificationMode(spk::ObservableValue<int>::NotificationMode::Immediate);
+
+    ASSERT_EQ(executionCount, 1) << "Leaving the deferred mode should notify the pending value";
+    ASSERT_EQ(spk::DeferredNotificationQueue::local().flush(), 0) << "Leaving the deferred mode should remove the value from the thread queue";
+}
+
+TEST_F(ObservableValueTest, DeferredValueDestroyedOnAnotherThread)
+{
+    std::optional<spk::ObservableValue<int>> deferredValue;
+    deferredValue.emplace(0, spk::ObservableValue<int>::NotificationMode::Deferred);
+    auto contract = deferredValue->subscribe(incrementCountJob);
+
+    std::atomic<int> step = 0;
+    size_t nbFlushed = 0;
+
+    std::thread owner([&]() {
+            deferredValue->set(1);
+            step = 1;
+            step.notify_one();
+            step.wait(1);
+            nbFlushed = spk::DeferredNotificationQueue::local().flush();
+        });
+
+    step.wait(0);
+    contract.resign();
+    deferredValue.reset();
+    step = 2;
+    step.notify_one();
+    owner.join();
+
+    ASSERT_EQ(nbFlushed, 0) << "A value destroyed on another thread should be skipped by the queue that holds it";
+    ASSERT_EQ(executionCount, 0) << "A destroyed value should never notify";
+}
+
+TEST_F(ObservableValueTest, SetDuringFlushIsQueuedForNextFlush)
+{
+    int receivedValue = -1;
+    auto contract = value.subscribe([&](const int& p_value) {
+            ++executionCount;
+            receivedValue = p_value;
+            if (p_value == 1)
+                value.set(2);
+        });
+
+    value.setNotificationMode(spk::ObservableValue<int>::NotificationMode::Deferred);
+    value.set(1);
+
+    ASSERT_EQ(spk::DeferredNotificationQueue::local().flush(), 1) << "Only the pending value should be flushed";
+    ASSERT_TRUE(value.isDirty()) << "A set made by a subscriber during the flush should be pending again";
+    ASSERT_EQ(spk::DeferredNotificationQueue::local().flush(), 1) << "The value set during the previous flush should be flushed next";
+    ASSERT_EQ(executionCount, 2) << "Subscribers should be notified once per flush";
+    ASSERT_EQ(receivedValue, 2) << "Subscribers should receive the value set during the previous flush";
+}
+
+TEST_F(ObservableValueTest, ThrowingSubscriberKeepsQueueUsable)
+{
+    spk::ObservableValue<int> otherValue(0, spk::ObservableValue<int>::NotificationMode::Deferred);
+    auto throwingContract = value.subscribe([](const int&) { throw std::runtime_error("Unable to handle value"); });
+    auto otherContract = otherValue.subscribe(incrementCountJob);
+
+    value.setNotificationMode(spk::ObservableValue<int>::NotificationMode::Deferred);
+    value.set(1);
+    otherValue.set(1);
+
+    ASSERT_THROW(spk::DeferredNotificationQueue::local().flush(), std::runtime_error) << "The subscriber exception should reach the flush caller";
+    ASSERT_FALSE(value.isDirty()) << "The value whose subscriber threw should no longer be pending";
+    ASSERT_TRUE(otherValue.isDirty()) << "Values not reached by the interrupted flush should stay pending";
+
+    throwingContract.resign();
+
+    ASSERT_EQ(spk::DeferredNotificationQueue::local().flush(), 1) << "The next flush should notify the values left by the interrupted one";
+    ASSERT_EQ(executionCount, 1) << "The value left by the interrupted flush should be notified once";
+    ASSERT_EQ(spk::DeferredNotificationQueue::local().flush(), 0) << "Nothing should remain pending after the second flush";
 }
\ No newline at end of file
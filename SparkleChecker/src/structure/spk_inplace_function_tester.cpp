@@ -0,0 +1,156 @@
+#include "structure/spk_inplace_function_tester.hpp"
+
+TEST_F(InplaceFunctionTest, DefaultConstructor)
+{
+    spk::InplaceFunction<void()> function;
+
+    ASSERT_FALSE(function) << "Default constructed function should be empty";
+    ASSERT_TRUE(function == nullptr) << "Default constructed function should compare equal to nullptr";
+    ASSERT_THROW(function(), std::bad_function_call) << "Calling an empty function should throw an error";
+}
+
+TEST_F(InplaceFunctionTest, CallLambda)
+{
+    spk::InplaceFunction<void()> function = [this]() { callCount++; };
+
+    function();
+    function();
+
+    ASSERT_TRUE(function) << "Function holding a lambda should not be empty";
+    ASSERT_EQ(callCount, 2) << "Function should call the stored lambda";
+}
+
+TEST_F(InplaceFunctionTest, ArgumentsAndReturnValue)
+{
+    spk::InplaceFunction<int(int, const std::string&)> function = [](int p_value, const std::string& p_text) {
+            return (p_value + static_cast<int>(p_text.size()));
+        };
+
+    ASSERT_EQ(function(2, "abc"), 5) << "Function should forward arguments and return the result";
+}
+
+TEST_F(InplaceFunctionTest, FunctionPointer)
+{
+    int (*pointer)(int) = [](int p_value) { return (p_value * 2); };
+    spk::InplaceFunction<int(int)> function = pointer;
+    int (*nullPointer)(int) = nullptr;
+    spk::InplaceFunction<int(int)> emptyFunction = nullPointer;
+
+    ASSERT_EQ(function(21), 42) << "Function should call the stored function pointer";
+    ASSERT_FALSE(emptyFunction) << "Function built from a null pointer should be empty";
+}
+
+TEST_F(InplaceFunctionTest, CaptureIsStoredInline)
+{
+    std::array<int, 8> values = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    auto lambda = [values]() { return (values[7]); };
+
+    ASSERT_TRUE((spk::InplaceFunction<int(), 48>::fitsInline<decltype(lambda)>())) << "Small captures should be stored inline";
+
+    spk::InplaceFunction<int(), 48> function = lambda;
+    ASSERT_EQ(function(), 8) << "Function should call the inline lambda";
+}
+
+TEST_F(InplaceFunctionTest, HeapFallback)
+{
+    std::array<int, 64> values = {};
+    values[63] = 12;
+    auto lambda = [values]() { return (values[63]); };
+
+    ASSERT_FALSE((spk::InplaceFunction<int(), 48, true>::fitsInline<decltype(lambda)>())) << "Large captures should not fit inline";
+
+    spk::InplaceFunction<int(), 48, true> function = lambda;
+    spk::InplaceFunction<int(), 48, true> copy = function;
+    spk::InplaceFunction<int(), 48, true> moved = std::move(function);
+
+    ASSERT_EQ(copy(), 12) << "Copied heap function should call its own lambda";
+    ASSERT_EQ(moved(), 12) << "Moved heap function should keep the lambda";
+    ASSERT_FALSE(function) << "Moved-from function should be empty";
+}
+
+TEST_F(InplaceFunctionTest, CopyAndMove)
+{
+    std::shared_ptr<int> tracker = std::make_shared<int>(0);
+    spk::InplaceFunction<int()> function = [tracker]() { return (++(*tracker)); };
+
+    ASSERT_EQ(tracker.use_count(), 2) << "Function should own its capture";
+
+    spk::InplaceFunction<int()> copy = function;
+    ASSERT_EQ(tracker.use_count(), 3) << "Copying a function should copy its capture";
+
+    spk::InplaceFunction<int()> moved = std::move(function);
+    ASSERT_EQ(tracker.use_count(), 3) << "Moving a function should not copy its capture";
+    ASSERT_FALSE(function) << "Moved-from function should be empty";
+
+    copy();
+    moved();
+    ASSERT_EQ(*tracker, 2) << "Both functions should call the same kind of lambda";
+
+    copy = nullptr;
+    moved.reset();
+    ASSERT_EQ(tracker.use_count(), 1) << "Resetting functions should release their capture";
+}
+
+TEST_F(InplaceFunctionTest, Reassign)
+{
+    spk::InplaceFunction<int()> function = []() { return (1); };
+    spk::InplaceFunction<int()> other = []() { return (2); };
+
+    function = other;
+    ASSERT_EQ(function(), 2) << "Assigned function should call the new lambda";
+
+    function = []() { return (3); };
+    ASSERT_EQ(function(), 3) << "Function should accept a new lambda";
+}
+
+TEST_F(InplaceFunctionTest, WrapStdFunction)
+{
+    std::function<void()> stdFunction = [this]() { callCount++; };
+    std::function<void()> emptyStdFunction;
+
+    spk::InplaceFunction<void(), 64> function = stdFunction;
+    spk::InplaceFunction<void(), 64> emptyFunction = emptyStdFunction;
+
+    function();
+    ASSERT_EQ(callCount, 1) << "Function should call the wrapped std::function";
+    ASSERT_FALSE(emptyFunction) << "Function built from an empty std::function should be empty";
+}
+
+TEST_F(InplaceFunctionTest, ValueArgumentsAreForwarded)
+{
+    spk::InplaceFunction<size_t(std::unique_ptr<int>, std::string)> function = [](std::unique_ptr<int> p_value, const std::string& p_text) {
+            return (static_cast<size_t>(*p_value) + p_text.size());
+        };
+    std::string text(64, 'a');
+    const char* textData = text.data();
+    const char* receivedData = nullptr;
+
+    spk::InplaceFunction<void(std::string)> observer = [&](const std::string& p_text) { receivedData = p_text.data(); };
+    observer(std::move(text));
+
+    ASSERT_EQ(function(std::make_unique<int>(2), "abc"), 5) << "Move-only value arguments should be forwarded to the callable";
+    ASSERT_EQ(receivedData, textData) << "Rvalue arguments should reach the callable without an intermediate copy";
+}
+
+TEST_F(InplaceFunctionTest, LvalueArgumentsAreAccepted)
+{
+    int receivedValue = 0;
+    std::string receivedText;
+
+    spk::InplaceFunction<void(int)> intFunction = [&](int p_value) { receivedValue = p_value; };
+    spk::InplaceFunction<void(std::string)> textFunction = [&](std::string p_text) { receivedText = std::move(p_text); };
+
+    int value = 42;
+    std::string text = "Sparkle";
+    const std::string constText = "Const";
+
+    intFunction(value);
+    ASSERT_EQ(receivedValue, 42) << "An lvalue int should be accepted by a value parameter";
+
+    textFunction(text);
+    ASSERT_EQ(receivedText, "Sparkle") << "An lvalue string should be accepted by a value parameter";
+    ASSERT_EQ(text, "Sparkle") << "Calling with an lvalue should copy it, leaving the caller's value untouched";
+
+    textFunction(constText);
+    ASSERT_EQ(receivedText, "Const") << "A const lvalue string should be accepted by a value parameter";
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "structure/thread/spk_asymmetric_fence_tester.hpp"
+
+TEST_F(AsymmetricFenceTest, FencesCanBeCalled)
+{
+	spk::AsymmetricFence::light();
+	spk::AsymmetricFence::heavy();
+
+	SUCCEED() << "Both fences should be callable, even without operating system support.";
+}
+
+TEST_F(AsymmetricFenceTest, StoresAreNeverBothMissed)
+{
+	size_t nbBothMissed = 0;
+	int hotResult = 0;
+	int coldResult = 0;
+
+	std::barrier roundStart(2);
+	std::barrier roundEnd(2, [&]() noexcept {
+			if (hotResult == 0 && coldResult == 0)
+				nbBothMissed++;
+			hotFlag.store(0, std::memory_order_relaxed);
+			coldFlag.store(0, std::memory_order_relaxed);
+		});
+
+	std::thread coldThread([&]() {
+			for (size_t i = 0; i < NbRound; i++)
+			{
+				roundStart.arrive_and_wait();
+				coldFlag.store(1, std::memory_order_relaxed);
+				spk::AsymmetricFence::heavy();
+				coldResult = hotFlag.load(std::memory_order_relaxed);
+				roundEnd.arrive_and_wait();
+			}
+		});
+
+	for (size_t i = 0; i < NbRound; i++)
+	{
+		roundStart.arrive_and_wait();
+		hotFlag.store(1, std::memory_order_relaxed);
+		spk::AsymmetricFence::light();
+		hotResult = coldFlag.load(std::memory_order_relaxed);
+		roundEnd.arrive_and_wait();
+	}
+	coldThread.join();
+
+	ASSERT_EQ(nbBothMissed, 0) << "A light and a heavy fence should never let both threads miss the other store.";
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "structure/thread/spk_future_tester.hpp"
+
+TEST_F(FutureTest, PromiseFulfillsFuture)
+{
+	spk::Promise<int> promise;
+	spk::Future<int> future = promise.future();
+
+	ASSERT_TRUE(future.isValid()) << "A future obtained from a promise should be valid.";
+	ASSERT_FALSE(future.ready()) << "Future should not be ready before its promise is fulfilled.";
+
+	promise.setValue(42);
+
+	ASSERT_TRUE(future.ready()) << "Future should be ready once its promise is fulfilled.";
+	ASSERT_EQ(future.get(), 42) << "Future should expose the value of its promise.";
+	ASSERT_THROW(promise.setValue(12), std::runtime_error) << "A promise should not be fulfilled twice.";
+}
+
+TEST_F(FutureTest, ThenChainsContinuations)
+{
+	spk::Promise<int> promise;
+	std::atomic<int> nbVoidCall = 0;
+
+	spk::Future<std::string> future = promise.future()
+		.then([](int& p_value) { return (p_value * 2); })
+		.then([](int& p_value) { return (std::to_string(p_value)); });
+	spk::Future<void> voidFuture = future.then([&](std::string&) { nbVoidCall++; });
+	spk::Future<int> afterVoidFuture = voidFuture.then([]() { return (7); });
+
+	ASSERT_FALSE(future.ready()) << "Continuations should wait for the source future.";
+
+	promise.setValue(21);
+
+	ASSERT_EQ(future.get(), "42") << "Continuations should run in order on the fulfilled value.";
+	ASSERT_EQ(nbVoidCall.load(), 1) << "Each continuation should run exactly once.";
+	ASSERT_EQ(afterVoidFuture.get(), 7) << "Continuations should chain after void futures.";
+	ASSERT_THROW(future.then([](std::string&) {}), std::runtime_error) << "A future should accept a single continuation.";
+
+	spk::Promise<int> readyPromise;
+	readyPromise.setValue(2);
+	spk::Future<int> readyFuture = readyPromise.future().then([](int& p_value) { return (p_value + 1); });
+
+	ASSERT_TRUE(readyFuture.ready()) << "A continuation on a ready future should run immediately.";
+	ASSERT_EQ(readyFuture.get(), 3) << "A continuation on a ready future should receive its value.";
+}
+
+TEST_F(FutureTest, ExceptionPropagatesThroughContinuations)
+{
+	spk::Promise<int> promise;
+	bool isCalled = false;
+
+	spk::Future<int> future = promise.future().then([&](int& p_value) { isCalled = true; return (p_value); });
+	promise.setException(std::make_exception_ptr(std::runtime_error("Failure")));
+
+	ASSERT_TRUE(future.ready()) << "A failed future should still become ready.";
+	ASSERT_FALSE(isCalled) << "Continuations should be skipped when the source future failed.";
+	ASSERT_THROW(future.get(), std::runtime_error) << "Exception should be rethrown by the chained future.";
+}
+
+TEST_F(FutureTest, AbandonedPromiseBreaksFuture)
+{
+	spk::Future<int> future;
+
+	{
+		spk::Promise<int> promise;
+		future = promise.future();
+	}
+
+	ASSERT_TRUE(future.ready()) << "Destroying the last promise should release its future.";
+	ASSERT_THROW(future.get(), std::runtime_error) << "A future of an abandoned promise should report an error.";
+}
+
+TEST_F(FutureTest, PostRunsOnWorker)
+{
+	renderer.start();
+
+	spk::Future<spk::PersistantWorker*> future = renderer.post([]() { return (spk::PersistantWorker::current()); });
+
+	ASSERT_EQ(future.get(), &renderer) << "A posted job should run on the targeted worker.";
+}
+
+TEST_F(FutureTest, PostedExceptionIsForwarded)
+{
+	renderer.start();
+
+	spk::Future<void> future = renderer.post([]() { throw std::runtime_error("Renderer failure"); });
+
+	ASSERT_THROW(future.get(), std::runtime_error) << "Exceptions raised by a posted job should be forwarded to its future.";
+}
+
+TEST_F(FutureTest, ContinuationReturnsToRequestingWorker)
+{
+	std::atomic<spk::PersistantWorker*> continuationWorker = nullptr;
+	spk::Promise<int> finished;
+	spk::Future<int> result = finished.future();
+
+	updater.start();
+	renderer.start();
+
+	updater.post([&]() {
+			renderer.post([]() { return (42); })
+				.then(updater, [&, finished](int& p_value) mutable {
+					continuationWorker = spk::PersistantWorker::current();
+					finished.setValue(p_value);
+				});
+		});
+
+	ASSERT_EQ(result.get(), 42) << "Renderer result should be delivered to the updater.";
+	ASSERT_EQ(continuationWorker.load(), &updater) << "Continuation should run on the executor it was chained with.";
+}
+
+TEST_F(FutureTest, WaitBlocksUntilReady)
+{
+	spk::Promise<int> promise;
+	spk::Future<int> future = promise.future();
+
+	std::thread producer([promise]() mutable {
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			promise.setValue(3);
+		});
+
+	future.wait();
+
+	ASSERT_TRUE(future.ready()) << "Wait should only return once the future is ready.";
+	ASSERT_EQ(future.get(), 3) << "Waiting thread should observe the produced value.";
+	producer.join();
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "structure/thread/spk_job_system_tester.hpp"
+
+TEST_F(JobSystemTest, WorkerCount)
+{
+	ASSERT_EQ(jobSystem.nbWorker(), 3) << "Job system should create the requested number of workers.";
+	ASSERT_GE(spk::JobSystem::defaultNbWorker(), 1) << "Default worker count should never be zero.";
+	ASSERT_THROW(spk::JobSystem(0), std::runtime_error) << "Creating a job system without worker should throw.";
+}
+
+TEST_F(JobSystemTest, SubmitAndWait)
+{
+	std::vector<spk::JobSystem::Handle> handles;
+
+	for (int i = 0; i < 100; i++)
+		handles.push_back(jobSystem.submit([&]() { counter++; }));
+
+	for (const spk::JobSystem::Handle& handle : handles)
+		jobSystem.wait(handle);
+
+	ASSERT_EQ(counter.load(), 100) << "Every submitted job should have been executed.";
+	for (const spk::JobSystem::Handle& handle : handles)
+		ASSERT_TRUE(handle.isDone()) << "Waited handles should be done.";
+}
+
+TEST_F(JobSystemTest, WaitIncludesSubJobs)
+{
+	spk::JobSystem::Handle handle = jobSystem.submit([&]() {
+			for (int i = 0; i < 10; i++)
+			{
+				jobSystem.submit([&]() {
+						for (int j = 0; j < 10; j++)
+							jobSystem.submit([&]() { counter++; });
+					});
+			}
+		});
+
+	jobSystem.wait(handle);
+
+	ASSERT_EQ(counter.load(), 100) << "Waiting on a job should wait for every job it spawned.";
+}
+
+TEST_F(JobSystemTest, ParallelForVisitsEveryIndex)
+{
+	std::vector<std::atomic<int>> visits(10000);
+
+	jobSystem.parallelFor(0, visits.size(), [&](size_t p_index) { visits[p_index]++; }, 16);
+
+	for (size_t i = 0; i < visits.size(); i++)
+		ASSERT_EQ(visits[i].load(), 1) << "Index " << i << " should be visited exactly once.";
+}
+
+TEST_F(JobSystemTest, NestedParallelFor)
+{
+	jobSystem.parallelFor(0, 16, [&](size_t) {
+			jobSystem.parallelFor(0, 16, [&](size_t) { counter++; }, 1);
+		}, 1);
+
+	ASSERT_EQ(counter.load(), 256) << "Nested parallelFor should visit every pair of indices.";
+}
+
+TEST_F(JobSystemTest, CurrentSystemInsideJob)
+{
+	std::atomic<spk::JobSystem*> observed = nullptr;
+
+	spk::JobSystem::Handle handle = jobSystem.submit([&]() { observed = spk::JobSystem::current(); });
+	while (handle.isDone() == false)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	ASSERT_EQ(observed.load(), &jobSystem) << "Jobs executed by a worker should observe their job system.";
+	ASSERT_EQ(spk::JobSystem::current(), nullptr) << "Threads outside the job system should not have a current job system.";
+}
+
+TEST_F(JobSystemTest, CompletionCallbackRunsOnce)
+{
+	std::atomic<bool> isReleased = false;
+	std::atomic<int> nbCallback = 0;
+
+	spk::JobSystem::Handle handle = jobSystem.submit([&]() {
+			while (isReleased.load() == false)
+				std::this_thread::yield();
+		});
+
+	handle.onCompletion([&]() { nbCallback++; });
+	ASSERT_THROW(handle.onCompletion([&]() { nbCallback++; }), std::runtime_error) << "A job should accept a single completion callback.";
+
+	isReleased = true;
+	jobSystem.wait(handle);
+	while (nbCallback.load() == 0)
+		std::this_thread::yield();
+
+	ASSERT_EQ(nbCallback.load(), 1) << "The completion callback should run once when the job completes.";
+
+	spk::JobSystem::Handle doneHandle = jobSystem.submit([]() {});
+	jobSystem.wait(doneHandle);
+	while (doneHandle.isDone() == false)
+		std::this_thread::yield();
+
+	bool isCalledInline = false;
+	doneHandle.onCompletion([&]() { isCalledInline = true; });
+
+	ASSERT_TRUE(isCalledInline) << "A callback registered on a finished job should run immediately.";
+	ASSERT_THROW(spk::JobSystem::Handle().onCompletion([]() {}), std::runtime_error) << "Registering a callback on an empty handle should throw.";
+}
\ No newline at end of file
@@ -112,4 +112,238 @@ TEST_F(PersistantWorkerTest, MultiplePreparationSteps)
 
 	ASSERT_TRUE(step1Executed) << "First preparation step should have been executed.";
 	ASSERT_TRUE(step2Executed) << "Second preparation step should have been executed.";
+}
+
+TEST_F(PersistantWorkerTest, CurrentWorker)
+{
+	std::atomic<spk::PersistantWorker*> currentWorker = nullptr;
+
+	spk::PersistantWorker worker(workerName);
+	worker.addExecutionStep([&]() {
+		currentWorker = spk::PersistantWorker::current();
+		}).relinquish();
+
+	worker.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	worker.stop();
+	worker.join();
+
+	ASSERT_EQ(currentWorker.load(), &worker) << "Execution steps should see the worker running them.";
+	ASSERT_EQ(spk::PersistantWorker::current(), nullptr) << "Threads outside of a worker should not see any worker.";
+}
+
+TEST_F(PersistantWorkerTest, FrameArenaResetEachIteration)
+{
+	std::atomic<size_t> maxUsed = 0;
+	std::atomic<int> nbIteration = 0;
+
+	spk::PersistantWorker worker(workerName);
+	worker.addExecutionStep([&]() {
+		std::pmr::vector<int> values(spk::PersistantWorker::currentFrameArena());
+		values.resize(100);
+		maxUsed = std::max(maxUsed.load(), spk::PersistantWorker::currentFrameArena()->used());
+		nbIteration++;
+		}).relinquish();
+
+	worker.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	worker.stop();
+	worker.join();
+
+	ASSERT_GT(nbIteration.load(), 1) << "Execution step should have been executed multiple times.";
+	ASSERT_LT(maxUsed.load(), 2 * 100 * sizeof(int)) << "Frame arena should be reset between iterations.";
+	ASSERT_GE(worker.frameArena().nbReset(), static_cast<size_t>(nbIteration.load())) << "Frame arena should be reset before each iteration.";
+}
+
+TEST_F(PersistantWorkerTest, DeferredNotificationsFlushedEachIteration)
+{
+	std::atomic<int> nbIteration = 0;
+	std::atomic<int> nbNotification = 0;
+	std::atomic<int> lastValue = 0;
+	std::unique_ptr<spk::ObservableValue<int>> observedValue;
+	spk::ObservableValue<int>::Contract valueContract;
+
+	spk::PersistantWorker worker(workerName);
+	worker.addPreparationStep([&]() {
+		observedValue = std::make_unique<spk::ObservableValue<int>>(0, spk::ObservableValue<int>::NotificationMode::Deferred);
+		valueContract = observedValue->subscribe([&](const int& p_value) {
+			nbNotification++;
+			lastValue = p_value;
+			});
+		}).relinquish();
+	worker.addExecutionStep([&]() {
+		int iteration = ++nbIteration;
+		for (int i = 0; i < 10; i++)
+			observedValue->set(iteration * 10 + i);
+		}).relinquish();
+
+	worker.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	worker.stop();
+	worker.join();
+
+	ASSERT_GT(nbIteration.load(), 1) << "Execution step should have been executed multiple times.";
+	ASSERT_EQ(nbNotification.load(), nbIteration.load()) << "Deferred value should be notified once per iteration.";
+	ASSERT_EQ(lastValue.load(), nbIteration.load() * 10 + 9) << "Deferred value should notify its final value.";
+
+	valueContract = spk::ObservableValue<int>::Contract();
+	observedValue.reset();
+}
+
+TEST_F(PersistantWorkerTest, DefaultRunPolicyIsSpin)
+{
+	spk::PersistantWorker worker(workerName);
+
+	ASSERT_EQ(worker.runPolicy(), spk::PersistantWorker::RunPolicy::Spin) << "Worker should keep spinning by default.";
+	ASSERT_EQ(worker.tickDuration(), spk::PersistantWorker::DefaultTickDuration) << "Worker should use the default tick duration.";
+	ASSERT_THROW(worker.setTickRate(0), std::runtime_error) << "A null tick rate should be rejected.";
+}
+
+TEST_F(PersistantWorkerTest, WakeOnWorkSleepsUntilWokenUp)
+{
+	std::atomic<int> nbIteration = 0;
+
+	spk::PersistantWorker worker(workerName);
+	worker.setRunPolicy(spk::PersistantWorker::RunPolicy::WakeOnWork);
+	worker.addExecutionStep([&]() { nbIteration++; }).relinquish();
+
+	worker.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+	int nbIdleIteration = nbIteration.load();
+
+	ASSERT_LE(nbIdleIteration, 2) << "Worker should not iterate while nobody wakes it up.";
+
+	for (int i = 0; i < 5; i++)
+	{
+		worker.wakeUp();
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+	worker.stop();
+	worker.join();
+
+	ASSERT_GE(nbIteration.load(), nbIdleIteration + 5) << "Worker should iterate once per wake up.";
+	ASSERT_LT(worker.statistics().utilization(), 0.5) << "An idle worker should spend most of its time waiting.";
+}
+
+TEST_F(PersistantWorkerTest, FixedRateLimitsIterations)
+{
+	std::atomic<int> nbIteration = 0;
+
+	spk::PersistantWorker worker(workerName);
+	worker.setTickRate(200);
+	worker.setRunPolicy(spk::PersistantWorker::RunPolicy::FixedRate);
+	worker.addExecutionStep([&]() { nbIteration++; }).relinquish();
+
+	worker.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	worker.stop();
+	worker.join();
+
+	ASSERT_GE(nbIteration.load(), 5) << "Worker should keep iterating at the requested rate.";
+	ASSERT_LE(nbIteration.load(), 30) << "Worker should not iterate faster than the requested rate.";
+	ASSERT_EQ(worker.statistics().nbIteration, static_cast<uint64_t>(nbIteration.load())) << "Statistics should count every iteration.";
+}
+
+TEST_F(PersistantWorkerTest, BackoffReducesUtilization)
+{
+	spk::PersistantWorker spinningWorker(L"SpinningWorker");
+	spk::PersistantWorker backoffWorker(L"BackoffWorker");
+	backoffWorker.setRunPolicy(spk::PersistantWorker::RunPolicy::Backoff);
+
+	spinningWorker.start();
+	backoffWorker.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	spinningWorker.stop();
+	backoffWorker.stop();
+	spinningWorker.join();
+	backoffWorker.join();
+
+	spk::PersistantWorker::Statistics spinningStatistics = spinningWorker.statistics();
+	spk::PersistantWorker::Statistics backoffStatistics = backoffWorker.statistics();
+
+	ASSERT_EQ(spinningStatistics.idleTime.count(), 0) << "A spinning worker should never be idle.";
+	ASSERT_GT(backoffStatistics.idleTime.count(), 0) << "A backing off worker should report idle time.";
+	ASSERT_LT(backoffStatistics.nbIteration, spinningStatistics.nbIteration) << "A backing off worker should iterate less than a spinning one.";
+
+	backoffWorker.resetStatistics();
+	ASSERT_EQ(backoffWorker.statistics().nbIteration, 0) << "Statistics should be cleared by resetStatistics.";
+}
+
+TEST_F(PersistantWorkerTest, TimedStepStatistics)
+{
+	spk::PersistantWorker worker(workerName);
+
+	spk::PersistantWorker::Contract fixedContract = worker.addFixedStep(L"Physics", std::chrono::milliseconds(5), [&]() { counter++; });
+	spk::PersistantWorker::Contract budgetedContract = worker.addBudgetedStep(L"Render", std::chrono::microseconds(50), [&]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		});
+
+	worker.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(60));
+	worker.stop();
+	worker.join();
+
+	std::vector<spk::TimedStep::Statistics> statistics = worker.stepStatistics();
+
+	ASSERT_EQ(statistics.size(), 2) << "Worker should report every timed step.";
+	ASSERT_EQ(statistics[0].name, L"Physics") << "Statistics should be reported in subscription order.";
+	ASSERT_GT(statistics[0].nbExecution, 0) << "Fixed step should have been executed.";
+	ASSERT_LE(statistics[0].nbExecution, 20) << "Fixed step should not run faster than its timestep.";
+	ASSERT_EQ(statistics[1].nbOverrun, statistics[1].nbExecution) << "Every slow execution should be reported as an overrun.";
+	ASSERT_THROW(worker.addFixedStep(L"Invalid", std::chrono::nanoseconds(0), [&]() {}), std::runtime_error) << "A fixed step without timestep should be rejected.";
+
+	budgetedContract.resign();
+
+	ASSERT_EQ(worker.stepStatistics().size(), 1) << "Resigned steps should no longer be reported.";
+}
+
+TEST_F(PersistantWorkerTest, FixedStepInterpolationIsReachable)
+{
+	spk::PersistantWorker worker(workerName);
+
+	spk::PersistantWorker::Contract fixedContract = worker.addFixedStep(L"Physics", std::chrono::milliseconds(5), [&]() { counter++; },
+		std::chrono::milliseconds(1), 2);
+	std::shared_ptr<const spk::TimedStep> physics = worker.timedStep(L"Physics");
+
+	std::atomic<double> maxInterpolation = -1;
+	spk::PersistantWorker::Contract renderContract = worker.addExecutionStep([&]() {
+		double interpolation = physics->interpolation();
+		if (interpolation > maxInterpolation.load())
+			maxInterpolation = interpolation;
+		});
+
+	worker.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+	double observed = physics->interpolation();
+	worker.stop();
+	worker.join();
+
+	ASSERT_GE(observed, 0.0) << "Interpolation read from another thread should stay positive.";
+	ASSERT_LT(observed, 1.0) << "Interpolation read from another thread should stay below one timestep.";
+	ASSERT_GE(maxInterpolation.load(), 0.0) << "Another step should be able to read the fixed step interpolation.";
+	ASSERT_LT(maxInterpolation.load(), 1.0) << "Interpolation should stay below one timestep.";
+	ASSERT_EQ(physics->statistics().budget, std::chrono::milliseconds(1)) << "The budget given to the fixed step should be kept.";
+	ASSERT_THROW(worker.timedStep(L"Unknown"), std::runtime_error) << "Requesting an unknown timed step should throw.";
+}
+
+TEST_F(PersistantWorkerTest, ConstructorPlacementIsApplied)
+{
+	size_t requestedCore = spk::CpuTopology::local().logicalCores().back().id;
+	std::atomic<size_t> observedCore = SIZE_MAX;
+
+	spk::ThreadPlacement placement;
+	placement.cores = { requestedCore };
+
+	spk::PersistantWorker worker(workerName, placement);
+	spk::PersistantWorker::Contract contract = worker.addExecutionStep([&]() { observedCore = spk::CpuTopology::currentCore(); });
+
+	worker.start();
+	while (observedCore.load() == SIZE_MAX)
+		std::this_thread::yield();
+	worker.stop();
+	worker.join();
+
+	ASSERT_EQ(worker.placement().cores, std::vector<size_t>({ requestedCore })) << "Worker should keep the placement given to its constructor.";
+	ASSERT_TRUE(worker.isPlacementApplied()) << "Placement given to the worker constructor should be applied when it starts.";
+	ASSERT_EQ(observedCore.load(), requestedCore) << "Worker should run on the core given to its constructor.";
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "structure/thread/spk_task_graph_tester.hpp"
+
+TEST_F(TaskGraphTest, AddTask)
+{
+	spk::TaskGraph::TaskID task = graph.addTask(L"Update", updater, []() {});
+
+	ASSERT_EQ(graph.size(), 1) << "Graph should contain the added task.";
+	ASSERT_EQ(graph.name(task), L"Update") << "Task should keep its name.";
+	ASSERT_EQ(graph.completedFrame(task), 0) << "A task should not have completed any frame before the graph starts.";
+	ASSERT_THROW(graph.addDependency(task, task), std::runtime_error) << "A task should not depend on itself within the same frame.";
+	ASSERT_THROW(graph.addDependency(task, 42), std::runtime_error) << "Dependencies on unknown tasks should be rejected.";
+}
+
+TEST_F(TaskGraphTest, CycleIsRejected)
+{
+	spk::TaskGraph::TaskID first = graph.addTask(L"First", updater, []() {});
+	spk::TaskGraph::TaskID second = graph.addTask(L"Second", renderer, []() {});
+
+	graph.addDependency(first, second);
+	graph.addDependency(second, first);
+
+	ASSERT_THROW(graph.start(), std::runtime_error) << "A graph containing a same frame cycle should not start.";
+	ASSERT_FALSE(graph.isRunning()) << "A rejected graph should not be running.";
+}
+
+TEST_F(TaskGraphTest, CrossWorkerDependencyIsRespected)
+{
+	std::atomic<uint64_t> producedFrame = 0;
+	std::atomic<int> nbMismatch = 0;
+	std::atomic<uint64_t> nbRender = 0;
+
+	spk::TaskGraph::TaskID update = graph.addTask(L"Update", updater, [&]() { producedFrame++; });
+	spk::TaskGraph::TaskID render = graph.addTask(L"Render", renderer, [&]() {
+			if (producedFrame.load() != ++nbRender)
+				nbMismatch++;
+		});
+
+	graph.addDependency(render, update);
+	graph.addDependency(update, render, 1);
+
+	runUntil([&]() { return (nbRender.load() >= 20); });
+
+	ASSERT_GT(nbRender.load(), 1) << "Render task should have run several frames.";
+	ASSERT_EQ(nbMismatch.load(), 0) << "Render should always observe the update of its own frame, never an older or newer one.";
+	ASSERT_LE(graph.completedFrame(update), graph.completedFrame(render) + 1) << "Update should never get more than one frame ahead of render.";
+}
+
+TEST_F(TaskGraphTest, SameWorkerTasksFollowDependencies)
+{
+	std::vector<int> order;
+	std::atomic<size_t> nbFrame = 0;
+
+	spk::TaskGraph::TaskID last = graph.addTask(L"Last", updater, [&]() { order.push_back(2); nbFrame++; });
+	spk::TaskGraph::TaskID first = graph.addTask(L"First", updater, [&]() { order.push_back(0); });
+	spk::TaskGraph::TaskID middle = graph.addTask(L"Middle", updater, [&]() { order.push_back(1); });
+
+	graph.addDependency(last, middle);
+	graph.addDependency(middle, first);
+
+	runUntil([&]() { return (nbFrame.load() >= 3); });
+
+	ASSERT_GE(order.size(), 3) << "Every task should have run at least once.";
+	for (size_t i = 0; i < order.size(); i++)
+		ASSERT_EQ(order[i], static_cast<int>(i % 3)) << "Tasks sharing a worker should run in dependency order.";
+}
+
+TEST_F(TaskGraphTest, StopReleasesWaitingWorkers)
+{
+	spk::PersistantWorker idleWorker(L"Idle");
+
+	spk::TaskGraph::TaskID never = graph.addTask(L"Never", idleWorker, []() {});
+	spk::TaskGraph::TaskID waiting = graph.addTask(L"Waiting", renderer, []() {});
+	graph.addDependency(waiting, never);
+
+	graph.start();
+	renderer.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	graph.stop();
+	renderer.stop();
+	renderer.join();
+
+	ASSERT_EQ(graph.completedFrame(waiting), 0) << "A task waiting on a task that never runs should not complete.";
+	ASSERT_FALSE(graph.isRunning()) << "Graph should not be running after stop.";
+}
+
+TEST_F(TaskGraphTest, RestartWhileWorkersAreRunning)
+{
+	std::atomic<uint64_t> nbRender = 0;
+
+	spk::TaskGraph::TaskID update = graph.addTask(L"Update", updater, []() {});
+	spk::TaskGraph::TaskID render = graph.addTask(L"Render", renderer, [&]() { nbRender++; });
+	graph.addDependency(render, update);
+	graph.addDependency(update, render, 1);
+
+	updater.start();
+	renderer.start();
+	for (size_t i = 0; i < 20; i++)
+	{
+		uint64_t nbPreviousRender = nbRender.load();
+
+		graph.start();
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(2000);
+		while (nbRender.load() == nbPreviousRender && std::chrono::steady_clock::now() < deadline)
+			std::this_thread::yield();
+		graph.stop();
+
+		ASSERT_GT(nbRender.load(), nbPreviousRender) << "A restarted graph should keep executing its tasks.";
+	}
+	updater.stop();
+	renderer.stop();
+	updater.join();
+	renderer.join();
+
+	ASSERT_FALSE(graph.isRunning()) << "Graph should not be running after stop.";
+	ASSERT_LE(graph.completedFrame(update), graph.completedFrame(render) + 1) << "Update should never get more than one frame ahead of render after a restart.";
+}
+
+TEST_F(TaskGraphTest, DestroyedWhileWorkersAreRunning)
+{
+	std::atomic<uint64_t> nbRender = 0;
+
+	updater.start();
+	renderer.start();
+	for (size_t i = 0; i < 20; i++)
+	{
+		uint64_t nbPreviousRender = nbRender.load();
+
+		{
+			spk::TaskGraph localGraph;
+			spk::TaskGraph::TaskID update = localGraph.addTask(L"Update", updater, []() {});
+			spk::TaskGraph::TaskID render = localGraph.addTask(L"Render", renderer, [&]() { nbRender++; });
+			localGraph.addDependency(render, update);
+
+			localGraph.start();
+			std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(2000);
+			while (nbRender.load() == nbPreviousRender && std::chrono::steady_clock::now() < deadline)
+				std::this_thread::yield();
+		}
+
+		ASSERT_GT(nbRender.load(), nbPreviousRender) << "Each graph should execute its tasks before being destroyed.";
+	}
+	uint64_t nbRenderAfterDestruction = nbRender.load();
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	updater.stop();
+	renderer.stop();
+	updater.join();
+	renderer.join();
+
+	ASSERT_EQ(nbRender.load(), nbRenderAfterDestruction) << "A destroyed graph should never execute its tasks again.";
+}
\ No newline at end of file
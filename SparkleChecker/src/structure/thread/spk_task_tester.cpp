@@ -0,0 +1,174 @@
+#include "structure/thread/spk_task_tester.hpp"
+
+namespace
+{
+	spk::Task<int> immediateValue(int p_value)
+	{
+		co_return p_value;
+	}
+
+	spk::Task<int> doubledValue(int p_value)
+	{
+		int value = co_await immediateValue(p_value);
+		co_return value * 2;
+	}
+
+	spk::Task<> throwingTask()
+	{
+		throw std::runtime_error("Task failure");
+		co_return;
+	}
+
+	spk::Task<spk::PersistantWorker*> currentWorker(spk::PersistantWorker& p_worker)
+	{
+		co_await p_worker;
+		co_return spk::PersistantWorker::current();
+	}
+
+	spk::Task<uint64_t> frameDistance(spk::PersistantWorker& p_worker, const std::atomic<uint64_t>& p_frame)
+	{
+		co_await p_worker;
+		uint64_t start = p_frame.load();
+		co_await spk::nextFrame();
+		co_await spk::nextFrame();
+		co_return p_frame.load() - start;
+	}
+
+	spk::Task<int> jobResult(spk::PersistantWorker& p_worker, spk::JobSystem& p_jobSystem)
+	{
+		co_await p_worker;
+
+		int result = 0;
+		co_await p_jobSystem.submit([&result]() {
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+				result = 42;
+			});
+
+		if (spk::PersistantWorker::current() != &p_worker)
+			co_return -1;
+		co_return result;
+	}
+
+	spk::Task<> awaitNextFrame()
+	{
+		co_await spk::nextFrame();
+	}
+}
+
+TEST_F(TaskTest, ImmediateTaskCompletes)
+{
+	spk::Task<int> task = immediateValue(12);
+
+	ASSERT_TRUE(task.isValid()) << "A coroutine should return a valid task.";
+	ASSERT_TRUE(task.isDone()) << "A task without suspension point should complete immediately.";
+	ASSERT_EQ(task.result(), 12) << "Task should expose its returned value.";
+}
+
+TEST_F(TaskTest, TaskCanAwaitTask)
+{
+	spk::Task<int> task = doubledValue(21);
+
+	ASSERT_TRUE(task.isDone()) << "Awaiting a finished task should not suspend.";
+	ASSERT_EQ(task.result(), 42) << "Awaiting a task should return its value.";
+}
+
+TEST_F(TaskTest, ExceptionIsRethrown)
+{
+	spk::Task<> task = throwingTask();
+
+	ASSERT_TRUE(task.isDone()) << "A throwing task should complete.";
+	ASSERT_THROW(task.result(), std::runtime_error) << "Exception raised inside the coroutine should be rethrown by result.";
+}
+
+TEST_F(TaskTest, UnfinishedTaskRejectsResult)
+{
+	spk::Task<uint64_t> task = frameDistance(worker, frame);
+
+	ASSERT_FALSE(task.isDone()) << "Task should be waiting for the worker to start.";
+	ASSERT_THROW(task.result(), std::runtime_error) << "Result of an unfinished task should not be accessible.";
+
+	worker.start();
+	task.wait();
+}
+
+TEST_F(TaskTest, AwaitWorkerResumesOnWorker)
+{
+	worker.start();
+
+	spk::Task<spk::PersistantWorker*> task = currentWorker(worker);
+	task.wait();
+
+	ASSERT_EQ(task.result(), &worker) << "Awaiting a worker should resume the coroutine on that worker thread.";
+}
+
+TEST_F(TaskTest, NextFrameWaitsForIteration)
+{
+	worker.start();
+
+	spk::Task<uint64_t> task = frameDistance(worker, frame);
+	task.wait();
+
+	ASSERT_EQ(task.result(), 2) << "Each nextFrame should resume the coroutine exactly one iteration later.";
+}
+
+TEST_F(TaskTest, NextFrameRequiresWorker)
+{
+	spk::Task<> task = awaitNextFrame();
+
+	ASSERT_TRUE(task.isDone()) << "Awaiting the next frame outside of a worker should fail immediately.";
+	ASSERT_THROW(task.result(), std::runtime_error) << "Awaiting the next frame outside of a worker should raise an error.";
+}
+
+TEST_F(TaskTest, AwaitJobResumesOnWorker)
+{
+	spk::JobSystem jobSystem(1);
+	worker.start();
+
+	spk::Task<int> task = jobResult(worker, jobSystem);
+	task.wait();
+
+	ASSERT_EQ(task.result(), 42) << "Awaiting a job should resume once the job is done, on the awaiting worker.";
+}
+
+TEST_F(TaskTest, AwaitJobDoesNotSpinIdleWorker)
+{
+	spk::JobSystem jobSystem(1);
+	worker.setRunPolicy(spk::PersistantWorker::RunPolicy::WakeOnWork);
+	worker.start();
+
+	spk::Task<int> task = jobResult(worker, jobSystem);
+	uint64_t startFrame = frame.load();
+	task.wait();
+
+	ASSERT_EQ(task.result(), 42) << "Awaiting a job should resume once the job is done, on the awaiting worker.";
+	ASSERT_LE(frame.load() - startFrame, 4) << "An idle worker awaiting a job should only be woken up by its completion.";
+}
+
+TEST_F(TaskTest, DetachedTaskKeepsRunning)
+{
+	std::atomic<bool> isFinished = false;
+
+	worker.start();
+	[](spk::PersistantWorker& p_worker, std::atomic<bool>& p_isFinished) -> spk::Task<> {
+			co_await p_worker;
+			co_await spk::nextFrame();
+			p_isFinished = true;
+			p_isFinished.notify_all();
+		}(worker, isFinished);
+
+	isFinished.wait(false);
+
+	ASSERT_TRUE(isFinished.load()) << "A discarded task should still run to completion.";
+}
+
+TEST_F(TaskTest, FramesAreRecycled)
+{
+	for (int i = 0; i < 4; i++)
+		doubledValue(i);
+
+	uint64_t nbHeapAllocation = spk::CoroutineFramePool::nbHeapAllocation();
+	for (int i = 0; i < 1000; i++)
+		ASSERT_EQ(doubledValue(i).result(), i * 2) << "Recycled frames should produce valid coroutines.";
+
+	ASSERT_EQ(spk::CoroutineFramePool::nbHeapAllocation(), nbHeapAllocation) << "Hot coroutines should reuse pooled frames instead of allocating.";
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "structure/thread/spk_thread_placement_tester.hpp"
+
+TEST_F(ThreadPlacementTest, TopologyCountsCores)
+{
+	ASSERT_EQ(topology.nbLogicalCore(), 8) << "Topology should expose every logical core.";
+	ASSERT_EQ(topology.nbPhysicalCore(), 4) << "Hyperthread siblings should share a physical core.";
+	ASSERT_EQ(topology.nbNumaNode(), 2) << "Topology should count NUMA nodes.";
+	ASSERT_EQ(topology.coresOfNode(1), std::vector<size_t>({ 4, 5, 6, 7 })) << "Cores of a node should be listed in order.";
+	ASSERT_TRUE(topology.coresOfNode(2).empty()) << "An unknown node should not contain any core.";
+}
+
+TEST_F(ThreadPlacementTest, DistributePrefersPhysicalCores)
+{
+	ASSERT_EQ(topology.distribute(2), std::vector<size_t>({ 0, 1 })) << "Threads should fill the physical cores of the first node first.";
+	ASSERT_EQ(topology.distribute(4), std::vector<size_t>({ 0, 1, 4, 5 })) << "Every physical core should be used before any hyperthread sibling.";
+	ASSERT_EQ(topology.distribute(6), std::vector<size_t>({ 0, 1, 4, 5, 2, 3 })) << "Hyperthread siblings should be used last.";
+	ASSERT_EQ(topology.distribute(12).size(), 8) << "No more threads than logical cores should be pinned.";
+}
+
+TEST_F(ThreadPlacementTest, LocalTopologyIsDetected)
+{
+	const spk::CpuTopology& local = spk::CpuTopology::local();
+
+	ASSERT_GE(local.nbLogicalCore(), 1) << "At least one logical core should be detected.";
+	ASSERT_LE(local.nbPhysicalCore(), local.nbLogicalCore()) << "There cannot be more physical than logical cores.";
+	ASSERT_GE(local.nbNumaNode(), 1) << "At least one NUMA node should be detected.";
+}
+
+TEST_F(ThreadPlacementTest, DefaultPlacementIsAlwaysApplied)
+{
+	spk::ThreadPlacement placement;
+
+	ASSERT_TRUE(placement.isDefault()) << "An untouched placement should be the default one.";
+	ASSERT_TRUE(placement.applyToCurrentThread()) << "Applying the default placement should always succeed.";
+}
+
+TEST_F(ThreadPlacementTest, ThreadIsPinnedOnRequestedCore)
+{
+	const spk::CpuTopology& local = spk::CpuTopology::local();
+	size_t requestedCore = local.logicalCores().back().id;
+	std::atomic<size_t> observedCore = SIZE_MAX;
+
+	spk::ThreadPlacement placement;
+	placement.cores = { requestedCore };
+
+	spk::Thread thread(L"Pinned", [&]() { observedCore = spk::CpuTopology::currentCore(); }, placement);
+	thread.start();
+	thread.join();
+
+	ASSERT_TRUE(thread.isPlacementApplied()) << "Pinning a thread on an available core should succeed.";
+	ASSERT_EQ(observedCore.load(), requestedCore) << "Thread should run on the core it was pinned on.";
+}
+
+TEST_F(ThreadPlacementTest, UnknownNumaNodeIsRejected)
+{
+	spk::ThreadPlacement placement;
+	placement.numaNode = 1024;
+
+	spk::Thread thread(L"Unplaced", []() {});
+	thread.setPlacement(placement);
+	thread.start();
+	thread.join();
+
+	ASSERT_TRUE(placement.allowedCores().empty()) << "A node without core should not allow any core.";
+	ASSERT_FALSE(thread.isPlacementApplied()) << "Placement on a missing NUMA node should be reported as failed.";
+}
\ No newline at end of file
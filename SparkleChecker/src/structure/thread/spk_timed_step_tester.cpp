@@ -0,0 +1,64 @@
+#include "structure/thread/spk_timed_step_tester.hpp"
+
+TEST_F(TimedStepTest, BudgetedStepRunsEveryCall)
+{
+	spk::TimedStep step(L"Budgeted", callback, std::chrono::milliseconds(10));
+
+	for (int i = 0; i < 5; i++)
+		step.execute();
+
+	spk::TimedStep::Statistics statistics = step.statistics();
+
+	ASSERT_FALSE(step.isFixed()) << "A step without timestep should not be fixed.";
+	ASSERT_EQ(counter, 5) << "A budgeted step should run once per execution.";
+	ASSERT_EQ(statistics.nbExecution, 5) << "Statistics should count every execution.";
+	ASSERT_EQ(statistics.nbOverrun, 0) << "A fast step should never overrun its budget.";
+	ASSERT_EQ(statistics.name, L"Budgeted") << "Statistics should carry the step name.";
+}
+
+TEST_F(TimedStepTest, OverrunIsRecorded)
+{
+	spk::TimedStep step(L"Slow", [this]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			counter++;
+		}, std::chrono::microseconds(100));
+
+	step.execute();
+	step.execute();
+
+	spk::TimedStep::Statistics statistics = step.statistics();
+
+	ASSERT_EQ(statistics.nbOverrun, 2) << "Every execution longer than the budget should be recorded as an overrun.";
+	ASSERT_GE(statistics.maxDuration, std::chrono::milliseconds(2)) << "Max duration should track the slowest execution.";
+	ASSERT_GE(statistics.averageDuration(), std::chrono::milliseconds(2)) << "Average duration should reflect the executions.";
+}
+
+TEST_F(TimedStepTest, FixedStepAccumulatesTime)
+{
+	spk::TimedStep step(L"Fixed", callback, std::chrono::nanoseconds(0), std::chrono::milliseconds(20));
+
+	step.execute();
+	ASSERT_EQ(counter, 0) << "The first execution should only start the accumulator.";
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	step.execute();
+
+	ASSERT_TRUE(step.isFixed()) << "A step with a timestep should be fixed.";
+	ASSERT_GE(counter, 2) << "Elapsed time should be consumed in fixed timesteps.";
+	ASSERT_LE(counter, 3) << "Fixed step should not run more often than elapsed time allows.";
+	ASSERT_LT(step.interpolation(), 1.0) << "Remaining accumulated time should stay below one timestep.";
+	ASSERT_EQ(step.statistics().budget, std::chrono::milliseconds(20)) << "A fixed step should default its budget to its timestep.";
+}
+
+TEST_F(TimedStepTest, CatchUpIsLimited)
+{
+	spk::TimedStep step(L"Limited", callback, std::chrono::nanoseconds(0), std::chrono::milliseconds(5), 2);
+
+	step.execute();
+	std::this_thread::sleep_for(std::chrono::milliseconds(60));
+	step.execute();
+
+	ASSERT_EQ(counter, 2) << "Fixed step should not run more than its catch up limit in a single execution.";
+	ASSERT_GE(step.statistics().nbDroppedStep, 8) << "Steps beyond the catch up limit should be dropped and recorded.";
+	ASSERT_LT(step.interpolation(), 1.0) << "Dropped time should not be kept in the accumulator.";
+}
\ No newline at end of file